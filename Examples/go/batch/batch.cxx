@@ -0,0 +1,26 @@
+/* File : batch.cxx */
+
+#include "example.h"
+
+double clamp(double x, double lo, double hi) {
+  return x < lo ? lo : (x > hi ? hi : x);
+}
+
+Histogram::Histogram(int nbins, double lo, double hi)
+  : nbins_(nbins), lo_(lo), width_((hi - lo) / nbins), counts_(new int[nbins]) {
+  for (int i = 0; i < nbins; i++)
+    counts_[i] = 0;
+}
+
+Histogram::~Histogram() {
+  delete [] counts_;
+}
+
+void Histogram::fill(double x) {
+  int bin = (int)((clamp(x, lo_, lo_ + width_ * nbins_) - lo_) / width_);
+  counts_[bin < nbins_ ? bin : nbins_ - 1]++;
+}
+
+int Histogram::count(int bin) const {
+  return bin >= 0 && bin < nbins_ ? counts_[bin] : 0;
+}
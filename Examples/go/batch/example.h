@@ -0,0 +1,15 @@
+/* File : example.h */
+
+double clamp(double x, double lo, double hi);
+
+class Histogram {
+public:
+  Histogram(int nbins, double lo, double hi);
+  ~Histogram();
+  void fill(double x);
+  int count(int bin) const;
+private:
+  int nbins_;
+  double lo_, width_;
+  int *counts_;
+};
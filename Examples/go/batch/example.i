@@ -0,0 +1,14 @@
+/* File : example.i */
+%module example
+
+%{
+#include "example.h"
+%}
+
+/* Generate ClampBatch, Histogram.FillBatch and Histogram.CountBatch
+   in addition to the usual wrappers */
+%feature("go:batch") clamp;
+%feature("go:batch") Histogram::fill;
+%feature("go:batch") Histogram::count;
+
+%include "example.h"
@@ -0,0 +1,77 @@
+// This example compares the time taken by calling small C++
+// functions one at a time with calling their batch wrappers, which
+// make a single cgo call for all the elements of a slice.
+
+package main
+
+import (
+	"./example"
+	"fmt"
+	"time"
+)
+
+const n = 1000000
+
+// report prints the time per element taken by f.
+func report(name string, f func()) time.Duration {
+	start := time.Now()
+	f()
+	d := time.Since(start) / n
+	fmt.Printf("%-32s %6d ns/element\n", name, d.Nanoseconds())
+	return d
+}
+
+func main() {
+	xs := make([]float64, n)
+	los := make([]float64, n)
+	his := make([]float64, n)
+	for i := range xs {
+		xs[i] = float64(i%200)/10 - 5
+		his[i] = 10
+	}
+
+	// ----- Global function -----
+
+	single := make([]float64, n)
+	batch := make([]float64, n)
+
+	report("Clamp", func() {
+		for i := range xs {
+			single[i] = example.Clamp(xs[i], los[i], his[i])
+		}
+	})
+	report("ClampBatch", func() {
+		example.ClampBatch(batch, xs, los, his)
+	})
+	for i := range single {
+		if single[i] != batch[i] {
+			panic(fmt.Sprintf("Clamp and ClampBatch differ at %d", i))
+		}
+	}
+
+	// ----- Member functions -----
+
+	h1 := example.NewHistogram(10, 0, 10)
+	defer example.DeleteHistogram(h1)
+	h2 := example.NewHistogram(10, 0, 10)
+	defer example.DeleteHistogram(h2)
+
+	report("Histogram.Fill", func() {
+		for _, x := range xs {
+			h1.Fill(x)
+		}
+	})
+	report("Histogram.FillBatch", func() {
+		h2.FillBatch(xs)
+	})
+
+	bins := []int{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}
+	counts := make([]int, len(bins))
+	h2.CountBatch(counts, bins)
+	for i, bin := range bins {
+		if h1.Count(bin) != counts[i] {
+			panic(fmt.Sprintf("Count and CountBatch differ for bin %d", bin))
+		}
+	}
+	fmt.Println("Histogram counts:", counts)
+}
@@ -0,0 +1,5 @@
+/* File : example.cxx */
+
+#include "example.h"
+
+int Vector::count = 0;
@@ -0,0 +1,15 @@
+/* File : example.h */
+
+class Vector {
+public:
+  Vector(double x = 0, double y = 0, double z = 0) : x(x), y(y), z(z) { count++; }
+  Vector(const Vector &other) : x(other.x), y(other.y), z(other.z) { count++; }
+  ~Vector() { count--; }
+  Vector add(const Vector &other) const { return Vector(x + other.x, y + other.y, z + other.z); }
+  double getX() const { return x; }
+
+  /* Number of C++ objects not yet deleted */
+  static int count;
+private:
+  double x, y, z;
+};
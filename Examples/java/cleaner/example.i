@@ -0,0 +1,17 @@
+/* File : example.i */
+
+/* Built twice, as module finalizer with the default finalizers and as module cleaner
+   with SWIG_JAVA_CLEANER defined. The proxy classes are renamed to keep them apart. */
+#if defined(SWIG_JAVA_CLEANER)
+%module cleaner
+%rename(CleanerVector) Vector;
+#else
+%module finalizer
+%rename(FinalizerVector) Vector;
+#endif
+
+%{
+#include "example.h"
+%}
+
+%include "example.h"
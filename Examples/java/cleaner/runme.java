@@ -0,0 +1,76 @@
+// This example compares the release of the C++ objects owned by many short-lived proxy objects
+// when using finalizers and when using the cleaner enabled by defining SWIG_JAVA_CLEANER.
+// Every iteration creates two proxies, one for the constructed and one for the returned object.
+// Pass the number of iterations on the command line to put more pressure on the garbage collector.
+
+public class runme {
+  static {
+    try {
+        System.loadLibrary("finalizer");
+        System.loadLibrary("cleaner");
+    } catch (UnsatisfiedLinkError e) {
+      System.err.println("Native code library failed to load. See the chapter on Dynamic Linking Problems in the SWIG Java documentation for help.\n" + e);
+      System.exit(1);
+    }
+  }
+
+  interface Benchmark {
+    double run(int iterations);
+    int count();
+  }
+
+  static void measure(String name, Benchmark benchmark, int iterations) throws InterruptedException {
+    long start = System.nanoTime();
+    double sum = benchmark.run(iterations);
+    long elapsed = System.nanoTime() - start;
+    int pending = benchmark.count();
+
+    // Wait for the remaining C++ objects to be deleted
+    long waitStart = System.nanoTime();
+    for (int i = 0; i < 1000 && benchmark.count() > 0; i++) {
+      System.gc();
+      Thread.sleep(1);
+    }
+    long waited = System.nanoTime() - waitStart;
+
+    System.out.println(name + ": " + (elapsed / 1000000) + " ms for " + iterations + " iterations (sum " + sum + "), " +
+                       pending + " C++ objects pending, " + (waited / 1000000) + " ms to release them, " + benchmark.count() + " left");
+  }
+
+  public static void main(String argv[]) throws InterruptedException {
+    int iterations = argv.length > 0 ? Integer.parseInt(argv[0]) : 1000000;
+
+    Benchmark finalizer = new Benchmark() {
+      public double run(int iterations) {
+        double sum = 0;
+        FinalizerVector v = new FinalizerVector(1, 2, 3);
+        for (int i = 0; i < iterations; i++)
+          sum += v.add(new FinalizerVector(i, 0, 0)).getX();
+        return sum;
+      }
+      public int count() {
+        return FinalizerVector.getCount();
+      }
+    };
+
+    Benchmark cleaner = new Benchmark() {
+      public double run(int iterations) {
+        double sum = 0;
+        CleanerVector v = new CleanerVector(1, 2, 3);
+        for (int i = 0; i < iterations; i++)
+          sum += v.add(new CleanerVector(i, 0, 0)).getX();
+        return sum;
+      }
+      public int count() {
+        return CleanerVector.getCount();
+      }
+    };
+
+    // Warm up
+    measure("finalizer", finalizer, iterations / 10);
+    measure("cleaner", cleaner, iterations / 10);
+
+    measure("finalizer", finalizer, iterations);
+    measure("cleaner", cleaner, iterations);
+  }
+}
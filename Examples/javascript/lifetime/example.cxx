@@ -0,0 +1,15 @@
+/* File : example.cxx */
+
+#include <math.h>
+#include "example.h"
+
+int Vector::ninstances = 0;
+
+double length(const Vector &v) {
+  return sqrt(v.dot(v));
+}
+
+double length(const Segment &s) {
+  Vector d(s.b.x - s.a.x, s.b.y - s.a.y);
+  return length(d);
+}
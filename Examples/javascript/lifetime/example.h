@@ -0,0 +1,30 @@
+/* File : example.h */
+
+class Vector {
+public:
+  Vector(double x = 0, double y = 0) : x(x), y(y) {
+    ninstances++;
+  }
+  virtual ~Vector() {
+    ninstances--;
+  }
+  double x, y;
+  Vector *self() { return this; }
+  double dot(const Vector &v) const { return x*v.x + y*v.y; }
+  static int ninstances;
+};
+
+class Vector3 : public Vector {
+public:
+  Vector3(double x = 0, double y = 0, double z = 0) : Vector(x, y), z(z) { }
+  double z;
+};
+
+class Segment {
+public:
+  Segment(const Vector &a, const Vector &b) : a(a), b(b) { }
+  Vector a, b;
+};
+
+double length(const Vector &v);
+double length(const Segment &s);
@@ -0,0 +1,44 @@
+// Measures the cost of creating, passing and collecting wrapped objects.
+// Rebuild with -DSWIGV8_PROXY_POOL_SIZE=0 to compare against the unpooled
+// proxy allocation.
+var example = require("example");
+
+function time(name, n, f) {
+  var start = process.hrtime();
+  f(n);
+  var t = process.hrtime(start);
+  console.log(name + ": " + ((t[0]*1e9 + t[1])/n).toFixed(1) + " ns");
+}
+
+var n = 1000000;
+var v = new example.Vector(3, 4);
+var w = new example.Vector3(1, 2, 3);
+var s = new example.Segment(v, w);
+
+time("create and collect owned objects", n, function(n) {
+  for (var i = 0; i < n; i++) {
+    new example.Vector(i, i);
+  }
+});
+time("return borrowed pointers", n, function(n) {
+  for (var i = 0; i < n; i++) {
+    v.self();
+  }
+});
+time("pass the exact type", n, function(n) {
+  for (var i = 0; i < n; i++) {
+    v.dot(v);
+  }
+});
+time("pass a derived type", n, function(n) {
+  for (var i = 0; i < n; i++) {
+    v.dot(w);
+  }
+});
+time("overload dispatch on the second overload", n, function(n) {
+  for (var i = 0; i < n; i++) {
+    example.length(s);
+  }
+});
+
+console.log(example.Vector.ninstances + " Vector instances left");
@@ -0,0 +1,16 @@
+%{
+#define FUNC(N) int f##N(int i) { return i + N; }
+#define FUNC10(N) FUNC(N##0) FUNC(N##1) FUNC(N##2) FUNC(N##3) FUNC(N##4) FUNC(N##5) FUNC(N##6) FUNC(N##7) FUNC(N##8) FUNC(N##9)
+#define FUNC100(N) FUNC10(N##0) FUNC10(N##1) FUNC10(N##2) FUNC10(N##3) FUNC10(N##4) FUNC10(N##5) FUNC10(N##6) FUNC10(N##7) FUNC10(N##8) FUNC10(N##9)
+FUNC100(1) FUNC100(2) FUNC100(3) FUNC100(4) FUNC100(5)
+%}
+
+// 500 functions and 2000 constants
+%define FUNC(N) int f##N(int i); %enddef
+%define CONST(N) %constant int C##N = N; %constant double D##N = N; %enddef
+%define REPEAT10(M, N) M(N##0) M(N##1) M(N##2) M(N##3) M(N##4) M(N##5) M(N##6) M(N##7) M(N##8) M(N##9) %enddef
+%define REPEAT100(M, N) REPEAT10(M, N##0) REPEAT10(M, N##1) REPEAT10(M, N##2) REPEAT10(M, N##3) REPEAT10(M, N##4) REPEAT10(M, N##5) REPEAT10(M, N##6) REPEAT10(M, N##7) REPEAT10(M, N##8) REPEAT10(M, N##9) %enddef
+
+REPEAT100(FUNC, 1) REPEAT100(FUNC, 2) REPEAT100(FUNC, 3) REPEAT100(FUNC, 4) REPEAT100(FUNC, 5)
+REPEAT100(CONST, 1) REPEAT100(CONST, 2) REPEAT100(CONST, 3) REPEAT100(CONST, 4) REPEAT100(CONST, 5)
+REPEAT100(CONST, 6) REPEAT100(CONST, 7) REPEAT100(CONST, 8) REPEAT100(CONST, 9) REPEAT100(CONST, 10)
@@ -0,0 +1,13 @@
+import sys
+sys.path.append('..')
+import harness
+from subprocess import call
+
+
+def proc(mod):
+    # Import the module in a new interpreter and use a handful of names
+    script = "import %s as m; m.f100(m.C100); m.f200(m.C200); m.f300(m.C300)" % mod.__name__
+    for i in range(50):
+        call([sys.executable, "-c", script])
+
+harness.run(proc, ('Simple_baseline', 'Simple_deferinit', 'Simple_optimized', 'Simple_optimized_deferinit'))
@@ -0,0 +1,25 @@
+%module(directors="1") Simple
+
+#ifdef NO_OVERRIDE_CACHE
+%begin %{
+#define SWIG_PYTHON_DIRECTOR_NO_OVERRIDE_CACHE
+%}
+#endif
+
+%feature("director") Handler;
+
+%inline %{
+class Handler {
+public:
+    virtual ~Handler () {}
+    virtual int handle (int i) { return i; }
+    virtual int filter (int i) { return i; }
+};
+
+int dispatch (Handler *h, int n) {
+    int sum = 0;
+    for (int i = 0; i < n; ++i)
+        sum += h->filter(h->handle(i));
+    return sum;
+}
+%}
@@ -0,0 +1,15 @@
+import sys
+sys.path.append('..')
+import harness
+
+
+def proc(mod):
+    # Only handle() is overridden, filter() is left to the C++ class
+    class MyHandler(mod.Handler):
+        def handle(self, i):
+            return i + 1
+    h = MyHandler()
+    for i in range(20):
+        mod.dispatch(h, 10000)
+
+harness.run(proc, ('Simple_baseline', 'Simple_optimized', 'Simple_builtin', 'Simple_nocache'))
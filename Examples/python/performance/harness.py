@@ -1,32 +1,27 @@
+from __future__ import print_function
+import importlib
 import sys
 import time
-import imp
 from subprocess import *
 
+try:
+    timer = time.perf_counter
+except AttributeError:
+    timer = time.clock
 
-def run(proc):
 
-    try:
-        mod = imp.find_module(sys.argv[1])
-        mod = imp.load_module(sys.argv[1], *mod)
+def run(proc, modules=('Simple_baseline', 'Simple_optimized', 'Simple_builtin')):
 
-        t1 = time.clock()
-        proc(mod)
-        t2 = time.clock()
-        print "%s took %f seconds" % (mod.__name__, t2 - t1)
-
-    except IndexError:
-        proc = Popen(
-            [sys.executable, 'runme.py', 'Simple_baseline'], stdout=PIPE)
-        (stdout, stderr) = proc.communicate()
-        print stdout
+    if len(sys.argv) > 1:
+        mod = importlib.import_module(sys.argv[1])
 
-        proc = Popen(
-            [sys.executable, 'runme.py', 'Simple_optimized'], stdout=PIPE)
-        (stdout, stderr) = proc.communicate()
-        print stdout
+        t1 = timer()
+        proc(mod)
+        t2 = timer()
+        print("%s took %f seconds" % (mod.__name__, t2 - t1))
 
-        proc = Popen(
-            [sys.executable, 'runme.py', 'Simple_builtin'], stdout=PIPE)
-        (stdout, stderr) = proc.communicate()
-        print stdout
+    else:
+        for name in modules:
+            proc = Popen([sys.executable, 'runme.py', name], stdout=PIPE, universal_newlines=True)
+            (stdout, stderr) = proc.communicate()
+            print(stdout)
@@ -0,0 +1,30 @@
+%include <std_string.i>
+%include <std_vector.i>
+%include <std_map.i>
+
+%template(DoubleVector) std::vector<double>;
+%template(StringDoubleMap) std::map<std::string, double>;
+
+%newobject make_vector;
+%newobject make_map;
+
+%inline %{
+#include <stdio.h>
+
+std::vector<double> *make_vector(int n) {
+    std::vector<double> *v = new std::vector<double>(n);
+    for (int i = 0; i < n; ++i)
+        (*v)[i] = i;
+    return v;
+}
+
+std::map<std::string, double> *make_map(int n) {
+    std::map<std::string, double> *m = new std::map<std::string, double>();
+    for (int i = 0; i < n; ++i) {
+        char key[32];
+        sprintf(key, "key%08d", i);
+        (*m)[key] = i;
+    }
+    return m;
+}
+%}
@@ -0,0 +1,17 @@
+import sys
+sys.path.append('..')
+import harness
+
+
+def proc(mod):
+    v = mod.make_vector(1000000)
+    m = mod.make_map(1000000)
+    for i in range(5):
+        for x in v:
+            pass
+        list(v)
+        for k in m:
+            pass
+        dict(m.iteritems())
+
+harness.run(proc, ('Simple_baseline', 'Simple_chunked', 'Simple_builtin', 'Simple_builtin_chunked'))
@@ -0,0 +1,25 @@
+#ifdef NOFREELIST
+%begin %{
+#define SWIG_PYTHON_FREELIST_SIZE 0
+%}
+#endif
+
+#ifdef NODIRECTDEALLOC
+%begin %{
+#define SWIG_PYTHON_NO_DIRECT_DEALLOC
+%}
+#endif
+
+%inline %{
+class MyClass {
+public:
+    MyClass () {}
+    ~MyClass () {}
+    MyClass *get_self () { return this; }
+    int value () const { return 0; }
+};
+
+typedef int (MyClass::*MyMethod)() const;
+
+MyMethod method () { return &MyClass::value; }
+%}
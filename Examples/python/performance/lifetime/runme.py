@@ -0,0 +1,16 @@
+import sys
+sys.path.append('..')
+import harness
+
+
+def proc(mod):
+    # Owned objects (SwigPyObject and the destructor call), borrowed
+    # pointers (SwigPyObject only) and member pointers (SwigPyPacked)
+    for i in range(300000):
+        x = mod.MyClass()
+    for i in range(1000000):
+        y = x.get_self()
+    for i in range(1000000):
+        m = mod.method()
+
+harness.run(proc, ('Simple_baseline', 'Simple_direct', 'Simple_freelist', 'Simple_builtin', 'Simple_builtin_freelist'))
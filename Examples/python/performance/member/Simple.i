@@ -0,0 +1,8 @@
+%inline %{
+struct Point {
+    double x;
+    double y;
+    int id;
+    Point () : x(0), y(0), id(0) {}
+};
+%}
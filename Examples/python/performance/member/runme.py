@@ -0,0 +1,12 @@
+import sys
+sys.path.append('..')
+import harness
+
+
+def proc(mod):
+    p = mod.Point()
+    for i in range(1000000):
+        p.x = p.y + 1.0
+        p.id = p.id + 1
+
+harness.run(proc, ('Simple_baseline', 'Simple_optimized', 'Simple_builtin', 'Simple_builtin_optimized'))
@@ -0,0 +1,37 @@
+#ifdef IDENTITYCACHE
+%pythonidentitycache Node;
+#endif
+
+%newobject build_tree;
+
+%inline %{
+#include <vector>
+
+class Node {
+    Node *parent_;
+    std::vector<Node *> children_;
+public:
+    Node (Node *parent = 0) : parent_(parent) {}
+    ~Node () {
+        for (size_t i = 0; i < children_.size(); ++i)
+            delete children_[i];
+    }
+    Node *parent () const { return parent_; }
+    int childCount () const { return (int)children_.size(); }
+    Node *child (int i) const { return children_[i]; }
+    Node *addChild () { children_.push_back(new Node(this)); return children_.back(); }
+};
+
+Node *build_tree (int depth, int fanout) {
+    Node *root = new Node();
+    std::vector<Node *> level(1, root);
+    for (int d = 0; d < depth; ++d) {
+        std::vector<Node *> next;
+        for (size_t n = 0; n < level.size(); ++n)
+            for (int i = 0; i < fanout; ++i)
+                next.push_back(level[n]->addChild());
+        level.swap(next);
+    }
+    return root;
+}
+%}
@@ -0,0 +1,28 @@
+import sys
+sys.path.append('..')
+import harness
+
+
+def depth(node):
+    d = 0
+    parent = node.parent()
+    while parent is not None:
+        d += 1
+        parent = parent.parent()
+    return d
+
+
+def walk(node, level):
+    # Depth first traversal, recomputing each node's depth from its parent links
+    if depth(node) != level:
+        raise RuntimeError("broken tree")
+    for i in range(node.childCount()):
+        walk(node.child(i), level + 1)
+
+
+def proc(mod):
+    root = mod.build_tree(6, 6)
+    for i in range(5):
+        walk(root, 0)
+
+harness.run(proc, ('Simple_baseline', 'Simple_identitycache', 'Simple_builtin', 'Simple_builtin_identitycache'))
@@ -0,0 +1,30 @@
+/* File : example.h */
+
+#include <vector>
+
+class Item {
+public:
+  Item(int id) : id_(id) {}
+  int id() const { return id_; }
+private:
+  int id_;
+};
+
+// Owns its items, Ruby only gets pointers to them
+class Warehouse {
+public:
+  Warehouse(int count) : items_(count) {
+    for (int i = 0; i < count; ++i)
+      items_[i] = new Item(i);
+  }
+  ~Warehouse() {
+    for (size_t i = 0; i < items_.size(); ++i)
+      delete items_[i];
+  }
+  int size() const { return (int)items_.size(); }
+  Item *get(int i) { return items_[i]; }
+private:
+  Warehouse(const Warehouse &);
+  Warehouse &operator=(const Warehouse &);
+  std::vector<Item *> items_;
+};
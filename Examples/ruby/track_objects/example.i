@@ -0,0 +1,12 @@
+/* File : example.i */
+%module example
+
+%{
+#include "example.h"
+%}
+
+/* Keep a mapping from each Item to its Ruby object, so that
+   Warehouse#get returns the same Ruby object for the same Item */
+%trackobjects Item;
+
+%include "example.h"
@@ -0,0 +1,44 @@
+# file: runme.rb
+
+# Times the object tracking of %trackobjects with millions of tracked
+# objects. Pass the number of objects as the first argument.
+
+require 'example'
+
+count = (ARGV[0] || 2_000_000).to_i
+
+def time_per_object(count)
+  start = Process.clock_gettime(Process::CLOCK_MONOTONIC)
+  yield
+  finish = Process.clock_gettime(Process::CLOCK_MONOTONIC)
+  (finish - start) * 1e9 / count
+end
+
+warehouse = Example::Warehouse.new(count)
+order = (0...count).to_a.shuffle
+items = nil
+
+# Each first get creates a Ruby object and adds a tracking
+add = time_per_object(count) { items = order.map { |i| warehouse.get(i) } }
+if $SWIG_TRACKINGS_COUNT != count
+  raise RuntimeError, "Expected #{count} trackings, got #{$SWIG_TRACKINGS_COUNT}"
+end
+
+# Each later get finds the Ruby object in the tracking table
+lookup = time_per_object(count) { order.each { |i| warehouse.get(i) } }
+if !warehouse.get(order[0]).equal?(items[0])
+  raise RuntimeError, "Tracked object not returned"
+end
+
+# The free function of each collected object removes its tracking,
+# this also includes the time taken by the garbage collector
+remove = time_per_object(count) do
+  items = nil
+  GC.start
+end
+if $SWIG_TRACKINGS_COUNT > count / 10
+  raise RuntimeError, "Expected most trackings to be removed, #{$SWIG_TRACKINGS_COUNT} left"
+end
+
+printf("%d tracked objects, ns per object: add %.0f, lookup %.0f, collect and remove %.0f\n",
+       count, add, lookup, remove)
@@ -0,0 +1,69 @@
+using System;
+using csharp_blittableNamespace;
+
+public class runme
+{
+  static void Main()
+  {
+    Vec3 v = new Vec3();
+    v.x = 1.0; v.y = 2.0; v.z = 3.0;
+
+    // member functions operate on the struct in place
+    if (v.length2() != 14.0)
+      throw new Exception("length2 failed");
+    v.scale(2.0);
+    if (v.x != 2.0 || v.y != 4.0 || v.z != 6.0)
+      throw new Exception("scale failed");
+    if (Vec3.dimensions() != 3)
+      throw new Exception("dimensions failed");
+    Vec3.count = 5;
+    if (Vec3.count != 5)
+      throw new Exception("static member variable failed");
+
+    // passing by value, reference and pointer
+    Vec3 w = csharp_blittable.add(v, v);
+    if (w.x != 4.0 || v.x != 2.0)
+      throw new Exception("add failed");
+    csharp_blittable.negate(ref w);
+    if (w.x != -4.0 || w.z != -12.0)
+      throw new Exception("negate failed");
+    csharp_blittable.doubleup(ref w);
+    if (w.x != -8.0)
+      throw new Exception("doubleup failed");
+    if (csharp_blittable.sum(v) != 12.0)
+      throw new Exception("sum failed");
+
+    // global variables and returned references are copied
+    Vec3 g = csharp_blittable.getGlobalVec();
+    if (g.x != 1.0 || g.z != 3.0)
+      throw new Exception("getGlobalVec failed");
+    csharp_blittable.globalVec = v;
+    if (csharp_blittable.globalVec.y != 4.0 || csharp_blittable.getGlobalVec().y != 4.0)
+      throw new Exception("globalVec failed");
+
+    // arrays
+    Vec3[] vecs = new Vec3[4];
+    csharp_blittable.fillAll(vecs, vecs.Length);
+    if (vecs[3].x != 3.0)
+      throw new Exception("fillAll failed");
+    if (csharp_blittable.sumAll(vecs, vecs.Length) != 6.0)
+      throw new Exception("sumAll failed");
+
+    // nested structs and layout
+    Box box = new Box();
+    box.hi = v;
+    box.colour = Colour.Blue;
+    box.flags = 0x81;
+    Box bigger = csharp_blittable.grow(box, 1.0);
+    if (bigger.lo.x != -1.0 || bigger.hi.z != 7.0 || bigger.colour != Colour.Blue || bigger.flags != 0x81)
+      throw new Exception("grow failed");
+    if (System.Runtime.InteropServices.Marshal.SizeOf(typeof(Box)) != (int)csharp_blittable.boxSize())
+      throw new Exception("Box size mismatch");
+
+    // member variables of a blittable type in a non-blittable class
+    Body body = new Body();
+    body.position = v;
+    if (body.position.z != 6.0)
+      throw new Exception("Body position failed");
+  }
+}
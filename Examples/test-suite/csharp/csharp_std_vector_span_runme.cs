@@ -0,0 +1,73 @@
+using System;
+using csharp_std_vector_spanNamespace;
+
+public class runme
+{
+  static void Main()
+  {
+    DoubleVector dv = new DoubleVector();
+
+    // Assign from a span, including an empty one
+    dv.Assign(new ReadOnlySpan<double>(new double[] {1.5, 2.5, 3.5, 4.5}));
+    if (dv.Count != 4 || dv[0] != 1.5 || dv[3] != 4.5)
+      throw new Exception("Assign(ReadOnlySpan) failed");
+    if (csharp_std_vector_span.sum(dv) != 12.0)
+      throw new Exception("sum failed");
+
+    // CopyTo a span, which can be larger than the vector
+    Span<double> dest = new double[6];
+    dv.CopyTo(dest);
+    if (dest[0] != 1.5 || dest[3] != 4.5 || dest[4] != 0.0)
+      throw new Exception("CopyTo(Span) failed");
+    Span<double> stack = stackalloc double[4];
+    dv.CopyTo(stack);
+    if (stack[2] != 3.5)
+      throw new Exception("CopyTo(stackalloc Span) failed");
+    try {
+      dv.CopyTo(new Span<double>(new double[3]));
+      throw new Exception("CopyTo(Span) too small not detected");
+    } catch (ArgumentException) {
+    }
+
+    // CopyFrom a slice of a span into the middle of the vector
+    double[] source = {9.0, 20.0, 30.0, 9.0};
+    dv.CopyFrom(1, new ReadOnlySpan<double>(source, 1, 2));
+    if (dv[0] != 1.5 || dv[1] != 20.0 || dv[2] != 30.0 || dv[3] != 4.5)
+      throw new Exception("CopyFrom(ReadOnlySpan) failed");
+    try {
+      dv.CopyFrom(3, new ReadOnlySpan<double>(source, 0, 2));
+      throw new Exception("CopyFrom(ReadOnlySpan) overflow not detected");
+    } catch (ArgumentException) {
+    }
+    try {
+      dv.CopyFrom(-1, new ReadOnlySpan<double>(source, 0, 1));
+      throw new Exception("CopyFrom(ReadOnlySpan) negative index not detected");
+    } catch (ArgumentOutOfRangeException) {
+    }
+
+    // AsSpan is a view of the vector's memory
+    Span<double> view = dv.AsSpan();
+    if (view.Length != 4 || view[1] != 20.0)
+      throw new Exception("AsSpan failed");
+    view[0] = 7.25;
+    if (dv[0] != 7.25)
+      throw new Exception("AsSpan write failed");
+
+    dv.Assign(ReadOnlySpan<double>.Empty);
+    if (dv.Count != 0 || dv.AsSpan().Length != 0)
+      throw new Exception("Assign(empty ReadOnlySpan) failed");
+
+    // Other element types
+    IntVector iv = new IntVector();
+    iv.Assign(new ReadOnlySpan<int>(new int[] {1, 2, 3}));
+    Span<int> ints = new int[3];
+    iv.CopyTo(ints);
+    if (ints[0] != 1 || ints[2] != 3 || iv.AsSpan()[1] != 2)
+      throw new Exception("IntVector spans failed");
+
+    UCharVector uv = new UCharVector();
+    uv.Assign(new ReadOnlySpan<byte>(new byte[] {0, 128, 255}));
+    if (uv.Count != 3 || uv[1] != 128 || uv.AsSpan()[2] != 255)
+      throw new Exception("UCharVector spans failed");
+  }
+}
@@ -0,0 +1,54 @@
+using System;
+using csharp_utf8_stringsNamespace;
+
+public class runme
+{
+  static void Main()
+  {
+    string ascii = "hello";
+    string utf8 = "héllo wörld € \U0001F600";
+
+    foreach (string s in new string[] { "", ascii, utf8 }) {
+      if (csharp_utf8_strings.ReturnConstCharPointer(s) != s)
+        throw new Exception("ReturnConstCharPointer failed for " + s);
+      if (csharp_utf8_strings.ReturnNewCharPointer(s) != s)
+        throw new Exception("ReturnNewCharPointer failed for " + s);
+      if (csharp_utf8_strings.ReturnString(s) != s)
+        throw new Exception("ReturnString failed for " + s);
+      if (csharp_utf8_strings.ReturnConstStringReference(s) != s)
+        throw new Exception("ReturnConstStringReference failed for " + s);
+    }
+
+    if (csharp_utf8_strings.ReturnNullCharPointer() != null)
+      throw new Exception("ReturnNullCharPointer failed");
+
+    // Strings are passed to C++ as UTF-8
+    if (csharp_utf8_strings.StringByteLength(utf8) != (uint)System.Text.Encoding.UTF8.GetByteCount(utf8))
+      throw new Exception("StringByteLength failed");
+
+    StringHolder holder = new StringHolder();
+    holder.charArray = "été";
+    if (holder.charArray != "été")
+      throw new Exception("charArray failed");
+    holder.str = utf8;
+    if (holder.str != utf8)
+      throw new Exception("str failed");
+
+    if (csharp_utf8_strings.CallJoin(new StringCallback(), utf8, "é") != utf8 + "é")
+      throw new Exception("CallJoin failed");
+    if (csharp_utf8_strings.CallJoin(new MyStringCallback(), utf8, "é") != "é" + utf8)
+      throw new Exception("CallJoin director failed");
+    if (csharp_utf8_strings.CallName(new MyStringCallback()) != "MyéStringCallback")
+      throw new Exception("CallName director failed");
+  }
+}
+
+public class MyStringCallback : StringCallback
+{
+  public override string Join(string a, string b) {
+    return b + a;
+  }
+  public override string Name() {
+    return "MyéStringCallback";
+  }
+}
@@ -188,6 +188,28 @@ public class li_std_vector_runme {
       }
       if (dvArray.Length != doubleArray.Length)
         throw new Exception("ToArray lengths mismatch");
+
+      // Assign() and CopyFrom() test
+      DoubleVector dvAssigned = new DoubleVector();
+      dvAssigned.Assign(doubleArray);
+      if (dvAssigned.Count != doubleArray.Length || dvAssigned[2] != doubleArray[2])
+        throw new Exception("Assign test (1) failed");
+      dvAssigned.CopyFrom(1, new double[] {-1.5, -2.5, -3.5}, 1, 2);
+      if (dvAssigned[0] != doubleArray[0] || dvAssigned[1] != -2.5 || dvAssigned[2] != -3.5)
+        throw new Exception("CopyFrom test (1) failed");
+      try {
+        dvAssigned.CopyFrom(dvAssigned.Count-1, new double[2], 0, 2);
+        throw new Exception("CopyFrom test (2) failed");
+      } catch (ArgumentException) {
+      }
+      try {
+        dvAssigned.CopyFrom(0, null, 0, 0);
+        throw new Exception("CopyFrom test (3) failed");
+      } catch (ArgumentNullException) {
+      }
+      dvAssigned.Assign(new double[0]);
+      if (dvAssigned.Count != 0)
+        throw new Exception("Assign test (2) failed");
     }
     {
       // Repeat() test
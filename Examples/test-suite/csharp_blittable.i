@@ -0,0 +1,78 @@
+%module csharp_blittable
+
+%include "csblittable.i"
+
+%csblittable(Vec3)
+%csblittable(Box)
+
+%inline %{
+enum Colour { Red, Green, Blue };
+
+struct Vec3 {
+  double x, y, z;
+  double length2() const { return x*x + y*y + z*z; }
+  void scale(double factor) { x *= factor; y *= factor; z *= factor; }
+  static int dimensions() { return 3; }
+  static int count;
+};
+int Vec3::count = 0;
+
+struct Box {
+  Vec3 lo;
+  Vec3 hi;
+  Colour colour;
+  unsigned char flags;
+};
+
+Vec3 add(Vec3 a, const Vec3 &b) {
+  Vec3 r = { a.x + b.x, a.y + b.y, a.z + b.z };
+  return r;
+}
+
+void negate(Vec3 &v) {
+  v.x = -v.x; v.y = -v.y; v.z = -v.z;
+}
+
+void doubleup(Vec3 *v) {
+  v->scale(2.0);
+}
+
+double sum(const Vec3 *v) {
+  return v->x + v->y + v->z;
+}
+
+Vec3 globalVec = { 1.0, 2.0, 3.0 };
+
+const Vec3 &getGlobalVec() {
+  return globalVec;
+}
+
+double sumAll(const Vec3 vecs[], int count) {
+  double total = 0.0;
+  for (int i = 0; i < count; ++i)
+    total += vecs[i].x + vecs[i].y + vecs[i].z;
+  return total;
+}
+
+void fillAll(Vec3 vecs[], int count) {
+  for (int i = 0; i < count; ++i) {
+    Vec3 v = { (double)i, 0.0, 0.0 };
+    vecs[i] = v;
+  }
+}
+
+Box grow(Box box, double amount) {
+  box.lo.x -= amount; box.lo.y -= amount; box.lo.z -= amount;
+  box.hi.x += amount; box.hi.y += amount; box.hi.z += amount;
+  return box;
+}
+
+size_t boxSize() {
+  return sizeof(Box);
+}
+
+struct Body {
+  Vec3 position;
+  double mass;
+};
+%}
@@ -0,0 +1,17 @@
+%module csharp_std_vector_span
+
+// Span<T> overloads of the bulk copying methods of std::vector, compiled with -DSWIG_CSHARP_SPAN
+%include <std_vector.i>
+
+%template(DoubleVector) std::vector<double>;
+%template(IntVector) std::vector<int>;
+%template(UCharVector) std::vector<unsigned char>;
+
+%inline %{
+double sum(const std::vector<double> &v) {
+  double total = 0;
+  for (size_t i = 0; i < v.size(); ++i)
+    total += v[i];
+  return total;
+}
+%}
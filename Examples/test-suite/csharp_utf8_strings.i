@@ -0,0 +1,68 @@
+%module(directors="1") csharp_utf8_strings
+
+// Tests the SWIG_CSHARP_UTF8_STRINGS string marshalling, see the SWIGOPT in csharp/Makefile.in
+
+%include <std_string.i>
+
+%feature("director") StringCallback;
+
+%inline %{
+#include <string>
+#include <string.h>
+
+const char *ReturnConstCharPointer(const char *s) {
+  static std::string copy;
+  copy = s;
+  return copy.c_str();
+}
+
+char *ReturnNullCharPointer() {
+  return 0;
+}
+
+%}
+
+%newobject ReturnNewCharPointer;
+
+%inline %{
+char *ReturnNewCharPointer(const char *s) {
+  char *copy = new char[strlen(s) + 1];
+  strcpy(copy, s);
+  return copy;
+}
+
+std::string ReturnString(const std::string &s) {
+  return s;
+}
+
+const std::string &ReturnConstStringReference(const std::string &s) {
+  static std::string copy;
+  copy = s;
+  return copy;
+}
+
+size_t StringByteLength(const std::string &s) {
+  return s.size();
+}
+
+struct StringHolder {
+  char charArray[32];
+  std::string str;
+  StringHolder() : str() { charArray[0] = 0; }
+};
+
+class StringCallback {
+public:
+  virtual ~StringCallback() {}
+  virtual std::string Join(const std::string &a, const char *b) { return a + b; }
+  virtual std::string Name() { return "StringCallback"; }
+};
+
+std::string CallJoin(StringCallback *callback, const std::string &a, const char *b) {
+  return callback->Join(a, b);
+}
+
+std::string CallName(StringCallback *callback) {
+  return callback->Name();
+}
+%}
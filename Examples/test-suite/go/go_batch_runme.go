@@ -0,0 +1,67 @@
+package main
+
+import . "./go_batch"
+
+func main() {
+	xs := []float64{1.5, -2, 0}
+	factors := []int{2, 3, 4}
+	scaled := make([]float64, len(xs))
+	ScaleBatch(scaled, xs, factors)
+	for i := range xs {
+		if scaled[i] != Scale(xs[i], factors[i]) {
+			panic(scaled)
+		}
+	}
+
+	sums := make([]int64, 2)
+	Add3Batch(sums, []int8{-1, 127}, []int16{1000, -1000}, []int64{1 << 40, 0})
+	if sums[0] != 999+1<<40 || sums[1] != -873 {
+		panic(sums)
+	}
+
+	positive := make([]bool, 3)
+	IsPositiveBatch(positive, []float32{1, -1, 0})
+	if !positive[0] || positive[1] || positive[2] {
+		panic(positive)
+	}
+
+	// Empty slices make no call.
+	ScaleBatch(nil, nil, nil)
+
+	func() {
+		defer func() {
+			if recover() == nil {
+				panic("expected panic for slices of different lengths")
+			}
+		}()
+		ScaleBatch(scaled, xs, factors[:2])
+	}()
+
+	if Greeting("go") != "hello go" {
+		panic(Greeting("go"))
+	}
+
+	a := NewAccumulator()
+	defer DeleteAccumulator(a)
+	a.AddBatch([]float64{1, 2, 3.5})
+	if a.Total() != 6.5 {
+		panic(a.Total())
+	}
+	weighted := make([]float64, 2)
+	a.WeightedBatch(weighted, []float64{2, 0.5}, []uint{3, 4})
+	if weighted[0] != 12.5 || weighted[1] != 8.5 {
+		panic(weighted)
+	}
+	totals := make([]float64, 2)
+	a.TotalBatch(totals)
+	if totals[0] != 6.5 || totals[1] != 6.5 {
+		panic(totals)
+	}
+
+	// The batch methods are part of the interface type.
+	var i Accumulator = a
+	i.AddBatch([]float64{1})
+	if i.Total() != 7.5 {
+		panic(i.Total())
+	}
+}
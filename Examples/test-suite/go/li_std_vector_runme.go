@@ -0,0 +1,67 @@
+package main
+
+import . "./li_std_vector"
+
+func main() {
+	iv := NewIntVector()
+	iv.Assign([]int32{1, 2, 3, 4})
+	if iv.Size() != 4 || iv.Get(3) != 4 {
+		panic(iv.Size())
+	}
+
+	view := iv.View()
+	if len(view) != 4 || view[0] != 1 || view[3] != 4 {
+		panic(view)
+	}
+	view[1] = 20
+	if iv.Get(1) != 20 {
+		panic(iv.Get(1))
+	}
+
+	dst := make([]int32, 2)
+	if n := iv.CopyTo(dst); n != 2 || dst[0] != 1 || dst[1] != 20 {
+		panic(dst)
+	}
+	dst = make([]int32, 10)
+	if n := iv.CopyTo(dst); n != 4 || dst[3] != 4 {
+		panic(n)
+	}
+
+	iv.Assign(nil)
+	if iv.Size() != 0 || len(iv.View()) != 0 || iv.CopyTo(dst) != 0 {
+		panic(iv.Size())
+	}
+
+	dv := NewDoubleVector()
+	dv.Assign([]float64{0.5, 1.5})
+	Halve_in_place(dv)
+	if v := dv.View(); v[0] != 0.25 || v[1] != 0.75 {
+		panic(v)
+	}
+
+	rv := NewRealVector()
+	rv.Assign([]float32{1, 2})
+	if v := Half(rv).View(); len(v) != 2 || v[1] != 1 {
+		panic(v)
+	}
+
+	sv := NewStringVector()
+	strs := []string{"one", "", "three", "four\x00four"}
+	sv.Assign(strs)
+	if sv.Size() != 4 || sv.Get(2) != "three" {
+		panic(sv.Size())
+	}
+	got := sv.ToSlice()
+	if len(got) != len(strs) {
+		panic(got)
+	}
+	for i := range strs {
+		if got[i] != strs[i] {
+			panic(got[i])
+		}
+	}
+	sv.Assign([]string{})
+	if sv.Size() != 0 || len(sv.ToSlice()) != 0 {
+		panic(sv.Size())
+	}
+}
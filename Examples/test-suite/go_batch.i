@@ -0,0 +1,38 @@
+// Test the go:batch feature, which adds wrappers taking slices of
+// arguments that call the C++ function for each element in a single
+// cgo call.
+
+%module go_batch
+
+%include <std_string.i>
+
+%feature("go:batch") scale;
+%feature("go:batch") add3;
+%feature("go:batch") isPositive;
+%feature("go:batch") Accumulator::add;
+%feature("go:batch") Accumulator::weighted;
+%feature("go:batch") Accumulator::total;
+
+// Not supported, so only the usual wrappers are generated.
+%warnfilter(SWIGWARN_GO_BATCH_UNSUPPORTED) greeting;
+%warnfilter(SWIGWARN_GO_BATCH_UNSUPPORTED) Accumulator::Accumulator;
+%feature("go:batch") greeting;
+%feature("go:batch") Accumulator::Accumulator;
+
+%inline %{
+#include <string>
+
+double scale(double x, int factor) { return x * factor; }
+long long add3(signed char a, short b, long long c) { return a + b + c; }
+bool isPositive(float f) { return f > 0; }
+std::string greeting(const std::string &name) { return "hello " + name; }
+
+class Accumulator {
+  double sum_;
+public:
+  Accumulator() : sum_(0) {}
+  void add(double x) { sum_ += x; }
+  double weighted(double x, unsigned int w) { return x * w + sum_; }
+  double total() const { return sum_; }
+};
+%}
@@ -0,0 +1,71 @@
+
+import java_cleaner.*;
+
+public class java_cleaner_runme {
+
+  static {
+    try {
+	System.loadLibrary("java_cleaner");
+    } catch (UnsatisfiedLinkError e) {
+      System.err.println("Native code library failed to load. See the chapter on Dynamic Linking Problems in the SWIG Java documentation for help.\n" + e);
+      System.exit(1);
+    }
+  }
+
+  // Give the cleanup thread a chance to delete the C++ objects, a double deletion shows up as fewer live objects than expected
+  private static void collect(int expected) throws Throwable {
+    for (int i = 0; i < 100 && (i < 5 || Counted.live() != expected); i++) {
+      System.gc();
+      Thread.sleep(10);
+    }
+    if (Counted.live() != expected)
+      throw new RuntimeException("C++ objects not released, live: " + Counted.live() + " expected: " + expected);
+  }
+
+  private static void create(int count) {
+    for (int i = 0; i < count; i++) {
+      new Counted();
+      new Derived(i);
+      java_cleaner.makeDerived(i);
+      java_cleaner.makeCountedOwned();
+      new Listener() {
+        public int handle(int i) {
+          return -i;
+        }
+      };
+    }
+  }
+
+  public static void main(String argv[]) throws Throwable {
+    try {
+      Counted.class.getDeclaredMethod("finalize");
+      throw new RuntimeException("finalize method generated");
+    } catch (NoSuchMethodException e) {
+    }
+
+    // Unreachable proxies owning the C++ object
+    int base = Counted.live();
+    create(1000);
+    collect(base);
+
+    // Deterministic deletion must not be repeated by the cleanup
+    Derived d = new Derived(10);
+    d.delete();
+    d.delete();
+    Counted notOwned = java_cleaner.makeCounted();
+    base = Counted.live();
+    d = null;
+    collect(base);
+
+    // Proxies not owning the C++ object do not delete it
+    notOwned = null;
+    collect(base);
+
+    // Ownership released to C++ and taken back by Java
+    Listener listener = new Listener();
+    listener.swigReleaseOwnership();
+    listener.swigTakeOwnership();
+    listener = null;
+    collect(base);
+  }
+}
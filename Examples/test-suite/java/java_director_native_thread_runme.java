@@ -0,0 +1,77 @@
+import java_director_native_thread.*;
+
+public class java_director_native_thread_runme {
+
+  static {
+    try {
+      System.loadLibrary("java_director_native_thread");
+    } catch (UnsatisfiedLinkError e) {
+      System.err.println("Native code library failed to load. See the chapter on Dynamic Linking Problems in the SWIG Java documentation for help.\n" + e);
+      System.exit(1);
+    }
+  }
+
+  public static void main(String argv[]) {
+    // The exception classes are cached on first use, on this thread
+    checkExceptions();
+
+    java_director_native_thread_Callback callback = new java_director_native_thread_Callback();
+    for (int i = 0; i < 3; i++) {
+      // A thread that is not attached is attached for the upcall and detached again afterwards
+      callback.thread = null;
+      if (java_director_native_thread.callFromNativeThread(callback, i, false) != 2 * i)
+        throw new RuntimeException("unattached thread result");
+      if (callback.thread == null || callback.thread == Thread.currentThread())
+        throw new RuntimeException("unattached thread upcall not made on the native thread");
+      if (java_director_native_thread.lastEnvStatus() != java_director_native_thread.getENV_DETACHED())
+        throw new RuntimeException("unattached thread left attached: " + java_director_native_thread.lastEnvStatus());
+
+      // A thread that is already attached is used as is and stays attached
+      callback.thread = null;
+      if (java_director_native_thread.callFromNativeThread(callback, i, true) != 2 * i)
+        throw new RuntimeException("attached thread result");
+      if (callback.thread == null || callback.thread == Thread.currentThread())
+        throw new RuntimeException("attached thread upcall not made on the native thread");
+      if (java_director_native_thread.lastEnvStatus() != java_director_native_thread.getENV_OK())
+        throw new RuntimeException("attached thread was detached: " + java_director_native_thread.lastEnvStatus());
+    }
+    if (callback.failure != null)
+      throw callback.failure;
+
+    // Cached exception classes still work on this thread
+    checkExceptions();
+  }
+
+  static void checkExceptions() {
+    try {
+      java_director_native_thread.throwIllegalArgument();
+      throw new RuntimeException("IllegalArgumentException not thrown");
+    } catch (IllegalArgumentException e) {
+      if (!e.getMessage().equals("illegal argument"))
+        throw new RuntimeException("wrong message: " + e.getMessage());
+    }
+    try {
+      java_director_native_thread.throwIndexOutOfBounds();
+      throw new RuntimeException("IndexOutOfBoundsException not thrown");
+    } catch (IndexOutOfBoundsException e) {
+      if (!e.getMessage().equals("index out of bounds"))
+        throw new RuntimeException("wrong message: " + e.getMessage());
+    }
+  }
+}
+
+class java_director_native_thread_Callback extends Callback {
+  Thread thread;
+  RuntimeException failure;
+
+  public int call(int i) {
+    thread = Thread.currentThread();
+    // Exceptions thrown on the native thread use the cached classes
+    try {
+      java_director_native_thread_runme.checkExceptions();
+    } catch (RuntimeException e) {
+      failure = e;
+    }
+    return 2 * i;
+  }
+}
@@ -112,6 +112,48 @@ public class java_lib_arrays_runme {
     ase.setArray_c2(array_c_extra);
     check_byte_array(array_c_extra, ase.getArray_c2());
 
+    // Critical array typemaps
+    double[] source = {1.5, 2.5, 3.5};
+    double[] target = new double[3];
+    java_lib_arrays.scale(source, target, 3, 2.0);
+    check_double_array(new double[] {3.0, 5.0, 7.0}, target);
+    check_double_array(new double[] {1.5, 2.5, 3.5}, source);
+
+    int[] values = {10, 20, 30};
+    if (java_lib_arrays.sum_critical(source, values, 3) != 66)
+      throw new RuntimeException("sum_critical failed");
+    check_int_array(new int[] {11, 22, 33}, values);
+
+    if (java_lib_arrays.sum_bytes(new byte[] {1, -2, 3}, 3) != 2)
+      throw new RuntimeException("sum_bytes failed");
+
+    try {
+      java_lib_arrays.scale(null, target, 0, 1.0);
+      throw new RuntimeException("null array not detected");
+    } catch (NullPointerException e) {
+    }
+
+    // A Java exception thrown while two critical arrays are held, both must be released first
+    double[] copied = new double[3];
+    if (java_lib_arrays.copy_checked(source, copied, new int[] {1, 2, 3}, 3) != 3)
+      throw new RuntimeException("copy_checked failed");
+    check_double_array(new double[] {1.5, 5.0, 10.5}, copied);
+    for (int i = 0; i < 3; i++) {
+      try {
+        java_lib_arrays.copy_checked(source, copied, new int[] {1, -1, 1}, 3);
+        throw new RuntimeException("copy_checked exception not thrown");
+      } catch (IllegalArgumentException e) {
+        if (!e.getMessage().equals("negative count"))
+          throw new RuntimeException("copy_checked wrong message: " + e.getMessage());
+      }
+    }
+    // The changes made before the exception are kept
+    check_double_array(new double[] {1.5, 5.0, 10.5}, copied);
+    try {
+      java_lib_arrays.copy_checked(source, null, new int[] {1, 2, 3}, 3);
+      throw new RuntimeException("null second array not detected");
+    } catch (NullPointerException e) {
+    }
  }
 
   // Functions to check that the array values were set correctly
@@ -0,0 +1,66 @@
+
+import java_std_string_bytes.*;
+
+public class java_std_string_bytes_runme {
+
+  static {
+    try {
+	System.loadLibrary("java_std_string_bytes");
+    } catch (UnsatisfiedLinkError e) {
+      System.err.println("Native code library failed to load. See the chapter on Dynamic Linking Problems in the SWIG Java documentation for help.\n" + e);
+      System.exit(1);
+    }
+  }
+
+  private static void check(byte[] expected, byte[] actual) {
+    if (!java.util.Arrays.equals(expected, actual))
+      throw new RuntimeException("bytes differ: " + java.util.Arrays.toString(actual));
+  }
+
+  private static byte[] contents(java.nio.ByteBuffer buffer) {
+    byte[] bytes = new byte[buffer.remaining()];
+    buffer.duplicate().get(bytes);
+    return bytes;
+  }
+
+  public static void main(String argv[]) {
+    // Embedded nulls and bytes which are not valid modified UTF-8 survive unchanged
+    byte[] data = new byte[] { 0, 1, (byte)0xc0, (byte)0x80, (byte)0xff, 0 };
+    check(data, java_std_string_bytes.echo_bytes(data));
+    check(new byte[0], java_std_string_bytes.echo_bytes(new byte[0]));
+    if (java_std_string_bytes.size_bytes(data) != data.length)
+      throw new RuntimeException("size_bytes failed");
+
+    java.nio.ByteBuffer buffer = java.nio.ByteBuffer.allocateDirect(16);
+    buffer.put((byte)9).put(data).flip();
+    buffer.get(); // only the bytes from the position are passed
+    java.nio.ByteBuffer result = java_std_string_bytes.echo_buffer(buffer);
+    if (!result.isDirect())
+      throw new RuntimeException("buffer not direct");
+    check(data, contents(result));
+    if (java_std_string_bytes.size_buffer(buffer) != data.length)
+      throw new RuntimeException("size_buffer failed");
+
+    try {
+      java_std_string_bytes.echo_buffer(java.nio.ByteBuffer.allocate(4));
+      throw new RuntimeException("non-direct buffer not detected");
+    } catch (IllegalArgumentException e) {
+    }
+
+    Holder holder = new Holder(data);
+    java.nio.ByteBuffer view = holder.view();
+    if (!view.isReadOnly())
+      throw new RuntimeException("view not read-only");
+    check(data, contents(view));
+
+    Callback callback = new Callback() {
+      public byte[] echo_bytes(byte[] bytes) {
+        byte[] reversed = new byte[bytes.length];
+        for (int i = 0; i < bytes.length; i++)
+          reversed[i] = bytes[bytes.length - 1 - i];
+        return reversed;
+      }
+    };
+    check(new byte[] { 0, (byte)0xff, (byte)0x80, (byte)0xc0, 1, 0 }, java_std_string_bytes.call_echo_bytes(callback, data));
+  }
+}
@@ -167,5 +167,55 @@ public class li_std_vector_runme {
       throw new RuntimeException("v11 test (2) failed");
     } catch (IndexOutOfBoundsException e) {
     }
+
+    // Bulk primitive array access
+    DoubleVector v12 = new DoubleVector();
+    v12.assign(new double[] {1.5, 2.5, 3.5, 4.5});
+    if (v12.size() != 4) throw new RuntimeException("v12 test (1) failed");
+    double[] a12 = v12.toArray(new double[0]);
+    if (a12.length != 4 || a12[0] != 1.5 || a12[3] != 4.5) throw new RuntimeException("v12 test (2) failed");
+    double[] b12 = new double[] {0, 0, 0, 0, 0};
+    if (v12.toArray(b12) != b12 || b12[2] != 3.5 || b12[4] != 0) throw new RuntimeException("v12 test (3) failed");
+    v12.setRange(1, new double[] {9, 20, 30, 9}, 1, 2);
+    if (v12.get(0) != 1.5 || v12.get(1) != 20 || v12.get(2) != 30 || v12.get(3) != 4.5) throw new RuntimeException("v12 test (4) failed");
+    double[] c12 = new double[3];
+    v12.getRange(2, c12, 1, 2);
+    if (c12[0] != 0 || c12[1] != 30 || c12[2] != 4.5) throw new RuntimeException("v12 test (5) failed");
+    try {
+      v12.getRange(3, c12, 0, 2);
+      throw new RuntimeException("v12 test (6) failed");
+    } catch (IndexOutOfBoundsException e) {
+    }
+    try {
+      v12.setRange(0, c12, 2, 2);
+      throw new RuntimeException("v12 test (7) failed");
+    } catch (ArrayIndexOutOfBoundsException e) {
+    }
+    java.nio.DoubleBuffer d12 = v12.asDirectBuffer();
+    if (d12.capacity() != 4 || d12.get(1) != 20) throw new RuntimeException("v12 test (8) failed");
+    d12.put(0, 7.25);
+    if (v12.get(0) != 7.25) throw new RuntimeException("v12 test (9) failed");
+    v12.assign(new double[0]);
+    if (!v12.isEmpty() || v12.asDirectBuffer().capacity() != 0) throw new RuntimeException("v12 test (10) failed");
+
+    try {
+      v12.getRange(0, null, 0, 0);
+      throw new RuntimeException("v12 test (11) failed");
+    } catch (NullPointerException e) {
+    }
+    try {
+      v12.setRange(0, null, 0, 0);
+      throw new RuntimeException("v12 test (12) failed");
+    } catch (NullPointerException e) {
+    }
+    try {
+      v12.assign(null);
+      throw new RuntimeException("v12 test (13) failed");
+    } catch (NullPointerException e) {
+    }
+
+    IntVector v13 = new IntVector();
+    v13.assign(new int[] {1, 2, 3});
+    if (v13.asDirectBuffer().get(2) != 3 || v13.toArray(new int[3])[1] != 2) throw new RuntimeException("v13 test failed");
   }
 }
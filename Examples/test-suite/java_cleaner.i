@@ -0,0 +1,36 @@
+// Test the proxy classes generated with SWIG_JAVA_CLEANER defined, which release the C++ objects
+// using phantom references instead of finalizers
+
+%module(directors="1") java_cleaner
+
+%feature("director") Listener;
+
+%inline %{
+struct Counted {
+  static int constructed;
+  static int destructed;
+  Counted() { constructed++; }
+  Counted(const Counted &) { constructed++; }
+  virtual ~Counted() { destructed++; }
+  static int live() { return constructed - destructed; }
+};
+int Counted::constructed = 0;
+int Counted::destructed = 0;
+
+struct Derived : Counted {
+  int value;
+  Derived(int value = 0) : value(value) {}
+};
+
+struct Listener : Counted {
+  virtual int handle(int i) { return i; }
+};
+
+Derived makeDerived(int value) { return Derived(value); }
+Counted *makeCounted() { return new Derived(1); }
+%}
+
+%newobject makeCountedOwned;
+%inline %{
+Counted *makeCountedOwned() { return new Derived(2); }
+%}
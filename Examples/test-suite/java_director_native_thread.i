@@ -0,0 +1,114 @@
+%module(directors="1") java_director_native_thread
+
+// Director upcalls from native threads, with and without the thread already attached to the JVM,
+// and exceptions thrown through the cached exception classes from different threads
+
+%{
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#endif
+
+struct NativeCall;
+extern "C" {
+#ifdef _WIN32
+  static unsigned int __stdcall native_call(void *p);
+#else
+  static void *native_call(void *p);
+#endif
+}
+%}
+
+%typemap(in, numinputs=0) JNIEnv *JENV "$1 = jenv;"
+
+%feature("director") Callback;
+
+%inline %{
+class Callback {
+public:
+  virtual ~Callback() {}
+  virtual int call(int i) { return i; }
+};
+
+static const int ENV_OK = JNI_OK;
+static const int ENV_DETACHED = JNI_EDETACHED;
+
+void throwIllegalArgument(JNIEnv *JENV) {
+  SWIG_JavaThrowException(JENV, SWIG_JavaIllegalArgumentException, "illegal argument");
+}
+
+void throwIndexOutOfBounds(JNIEnv *JENV) {
+  SWIG_JavaThrowException(JENV, SWIG_JavaIndexOutOfBoundsException, "index out of bounds");
+}
+%}
+
+%{
+struct NativeCall {
+  JavaVM *jvm;
+  Callback *callback;
+  int arg;
+  bool attach;
+  int result;
+  int env_status;
+};
+
+static int last_env_status = JNI_ERR;
+
+extern "C" {
+#ifdef _WIN32
+  static unsigned int __stdcall native_call(void *p)
+#else
+  static void *native_call(void *p)
+#endif
+  {
+    NativeCall *c = static_cast<NativeCall *>(p);
+    JNIEnv *env = 0;
+#if defined(__ANDROID__)
+    JNIEnv **penv = &env;
+#else
+    void **penv = (void **)&env;
+#endif
+    if (c->attach)
+      c->jvm->AttachCurrentThread(penv, NULL);
+    c->result = c->callback->call(c->arg);
+    // The director must leave the thread attached only if it was attached before the upcall
+    c->env_status = c->jvm->GetEnv((void **)&env, JNI_VERSION_1_2);
+    if (c->attach)
+      c->jvm->DetachCurrentThread();
+    return 0;
+  }
+}
+%}
+
+%inline %{
+// Calls back from a new native thread, optionally attached to the JVM by the thread itself first
+int callFromNativeThread(JNIEnv *JENV, Callback *callback, int arg, bool attach) {
+  NativeCall c;
+  JENV->GetJavaVM(&c.jvm);
+  c.callback = callback;
+  c.arg = arg;
+  c.attach = attach;
+  c.result = -1;
+  c.env_status = JNI_ERR;
+#ifdef _WIN32
+  HANDLE handle = (HANDLE)_beginthreadex(NULL, 0, native_call, &c, 0, NULL);
+  if (handle) {
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+  }
+#else
+  pthread_t thread;
+  if (pthread_create(&thread, NULL, native_call, &c) == 0)
+    pthread_join(thread, NULL);
+#endif
+  last_env_status = c.env_status;
+  return c.result;
+}
+
+// JNI GetEnv status of the native thread after the last upcall made by callFromNativeThread
+int lastEnvStatus() {
+  return last_env_status;
+}
+%}
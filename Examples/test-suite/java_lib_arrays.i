@@ -67,3 +67,52 @@ struct ArrayStructExtra {
 	char           array_c2[ARRAY_LEN];
 };
 %}
+
+// Test the critical array typemaps
+%apply double CRITICAL_INPUT[] { const double *source }
+%apply double CRITICAL[] { double *target }
+%apply int CRITICAL[] { int *values }
+%apply signed char CRITICAL_INPUT[] { const signed char *bytes }
+%apply int CRITICAL_INPUT[] { const int *counts }
+
+// Both arrays must be released before the Java exception is thrown
+%exception copy_checked {
+  $action
+  if (result < 0) {
+    $cleanup
+    SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "negative count");
+    return $null;
+  }
+}
+
+%inline %{
+void scale(const double *source, double *target, int nitems, double factor) {
+  int i;
+  for (i=0; i<nitems; ++i)
+    target[i] = source[i] * factor;
+}
+int sum_critical(const double *source, int *values, int nitems) {
+  int i, sum = 0;
+  for (i=0; i<nitems; ++i) {
+    values[i] += (int)source[i];
+    sum += values[i];
+  }
+  return sum;
+}
+int sum_bytes(const signed char *bytes, int nitems) {
+  int i, sum = 0;
+  for (i=0; i<nitems; ++i)
+    sum += bytes[i];
+  return sum;
+}
+/* Copies source into target, returns -1 if any of the counts is negative */
+int copy_checked(const double *source, double *target, const int *counts, int nitems) {
+  int i;
+  for (i=0; i<nitems; ++i) {
+    if (counts[i] < 0)
+      return -1;
+    target[i] = source[i] * counts[i];
+  }
+  return nitems;
+}
+%}
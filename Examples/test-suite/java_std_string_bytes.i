@@ -0,0 +1,34 @@
+// Test the std::string BYTES and NIOBUFFER typemaps which copy bytes without any UTF-8 conversion
+
+%module(directors="1") java_std_string_bytes
+
+%include <std_string.i>
+
+%apply std::string BYTES { std::string echo_bytes, std::string call_echo_bytes, std::string bytes };
+%apply const std::string &BYTES { const std::string &cbytes };
+%apply std::string NIOBUFFER { std::string echo_buffer, std::string buffer };
+%apply const std::string &NIOBUFFER { const std::string &cbuffer, const std::string &view };
+
+%feature("director") Callback;
+
+%inline %{
+#include <string>
+
+std::string echo_bytes(std::string bytes) { return bytes; }
+size_t size_bytes(const std::string &cbytes) { return cbytes.size(); }
+std::string echo_buffer(std::string buffer) { return buffer; }
+size_t size_buffer(const std::string &cbuffer) { return cbuffer.size(); }
+
+struct Holder {
+  std::string data;
+  Holder(std::string bytes) : data(bytes) {}
+  const std::string &view() const { return data; }
+};
+
+struct Callback {
+  virtual ~Callback() {}
+  virtual std::string echo_bytes(std::string bytes) { return bytes; }
+};
+
+std::string call_echo_bytes(Callback *callback, std::string bytes) { return callback->echo_bytes(bytes); }
+%}
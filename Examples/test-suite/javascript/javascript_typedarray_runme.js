@@ -0,0 +1,57 @@
+var javascript_typedarray = require("javascript_typedarray");
+
+var check = function(expected, actual) {
+  if (expected !== actual) {
+    throw new Error(actual + " does not equal " + expected);
+  }
+};
+
+var checkThrows = function(f) {
+  var thrown = false;
+  try {
+    f();
+  } catch (e) {
+    thrown = true;
+  }
+  if (!thrown) {
+    throw new Error("no exception thrown");
+  }
+};
+
+// std::vector returned by value
+var r = javascript_typedarray.range(5);
+check(true, r instanceof Float64Array);
+check(5, r.length);
+check(2, r[4]);
+check(0, javascript_typedarray.range(0).length);
+
+// std::vector passed by const reference and by value
+check(5, javascript_typedarray.sum(r));
+check(6, javascript_typedarray.sum(new Float64Array([1, 2, 3])));
+var rev = javascript_typedarray.reversed(new Int32Array([1, 2, 3]));
+check(true, rev instanceof Int32Array);
+check("3,2,1", Array.prototype.join.call(rev));
+
+// the overload is chosen by the element type
+check("double", javascript_typedarray.kind(new Float64Array(1)));
+check("int", javascript_typedarray.kind(new Int32Array(1)));
+checkThrows(function() { javascript_typedarray.sum([1, 2, 3]); });
+checkThrows(function() { javascript_typedarray.sum(new Float32Array(3)); });
+
+// pointer and length pairs use the elements of the array in place
+var values = new Float64Array([1, 2, 3, 4]);
+javascript_typedarray.scale(values, 2);
+check("2,4,6,8", Array.prototype.join.call(values));
+var part = new Float64Array(values.buffer, 8, 2);
+javascript_typedarray.scale(part, 10);
+check("2,40,60,8", Array.prototype.join.call(values));
+check(6, javascript_typedarray.sum_floats(new Float32Array([1, 2, 3])));
+
+// fixed size arrays
+check(6, javascript_typedarray.sum_triple(new Int32Array([1, 2, 3])));
+checkThrows(function() { javascript_typedarray.sum_triple(new Int32Array([1, 2])); });
+var t = new javascript_typedarray.Triple();
+t.triple = new Int32Array([4, 5, 6]);
+var triple = t.triple;
+check(true, triple instanceof Int32Array);
+check("4,5,6", Array.prototype.join.call(triple));
@@ -0,0 +1,57 @@
+%module javascript_typedarray
+
+%include <std_vector.i>
+%include <arrays_javascript.i>
+
+%apply std::vector<double> TYPEDARRAY { std::vector<double> };
+%apply const std::vector<double> &TYPEDARRAY { const std::vector<double> & };
+%apply std::vector<int> TYPEDARRAY { std::vector<int> };
+%apply const std::vector<int> &TYPEDARRAY { const std::vector<int> & };
+%apply (double *TYPEDARRAY, size_t LENGTH) { (double *values, size_t count) };
+%apply (const float *TYPEDARRAY, size_t LENGTH) { (const float *values, int count) };
+%apply int TYPEDARRAY[ANY] { int triple[3] };
+
+%inline %{
+#include <vector>
+
+std::vector<double> range(int n) {
+  std::vector<double> v;
+  for (int i = 0; i < n; i++)
+    v.push_back(i * 0.5);
+  return v;
+}
+
+double sum(const std::vector<double> &v) {
+  double s = 0;
+  for (size_t i = 0; i < v.size(); i++)
+    s += v[i];
+  return s;
+}
+
+std::vector<int> reversed(std::vector<int> v) {
+  return std::vector<int>(v.rbegin(), v.rend());
+}
+
+const char *kind(const std::vector<double> &) { return "double"; }
+const char *kind(const std::vector<int> &) { return "int"; }
+
+void scale(double *values, size_t count, double factor) {
+  for (size_t i = 0; i < count; i++)
+    values[i] *= factor;
+}
+
+double sum_floats(const float *values, int count) {
+  double s = 0;
+  for (int i = 0; i < count; i++)
+    s += values[i];
+  return s;
+}
+
+int sum_triple(int triple[3]) {
+  return triple[0] + triple[1] + triple[2];
+}
+
+struct Triple {
+  int triple[3];
+};
+%}
@@ -0,0 +1,28 @@
+require("import")	-- the import fn
+import("lua_borrowed_pointers")	-- import lib
+
+local t = lua_borrowed_pointers
+local w = t.World()
+
+-- borrowed pointers to the same object share a userdata
+local e1 = w:entity(1)
+assert(e1:getId() == 1)
+assert(rawequal(e1, w:entity(1)))
+assert(rawequal(e1, w:constEntity(1)))
+assert(not rawequal(e1, w:entity(2)))
+assert(w:entity(5) == nil)
+assert(w:sum(e1, w:entity(2)) == 3)
+
+-- owned pointers are always new userdata
+local c1 = w:create(7)
+local c2 = w:create(7)
+assert(not rawequal(c1, c2))
+assert(c1.id == 7)
+
+-- the userdata is recreated after it is collected
+e1 = nil
+collectgarbage()
+local e2 = w:entity(1)
+assert(e2:getId() == 1)
+e2.id = 10
+assert(w:entity(1).id == 10)
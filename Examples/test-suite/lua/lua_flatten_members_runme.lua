@@ -0,0 +1,29 @@
+require("import")	-- the import fn
+import("lua_flatten_members")	-- import lib
+
+local t = lua_flatten_members
+
+local d = t.Derived()
+assert(d:name() == "Derived")
+assert(d:base_only() == "Base::base_only")
+assert(d:other_only() == "Other::other_only")
+assert(d.x == 1 and d.y == 2 and d.z == 3)
+d.x = 10
+d.y = 20
+assert(d.x == 10 and d.y == 20)
+
+-- the most derived member is found
+local m = t.MoreDerived()
+assert(m:name() == "Derived")
+assert(m.x == 4)
+m.x = 40
+assert(m.x == 40)
+assert(m.z == 3)
+
+-- members added after registration are still found
+getmetatable(t.Base())[".fn"].added = function(self) return "added" end
+assert(m:added() == "added")
+
+-- unknown members
+assert(m.nonexistent == nil)
+assert(pcall(function() m.nonexistent = 1 end) == false)
@@ -0,0 +1,24 @@
+%module lua_borrowed_pointers
+
+%include <lua_borrowed.i>
+%lua_borrowed(Entity)
+
+%newobject World::create;
+
+%inline %{
+struct Entity {
+  int id;
+  Entity(int id = 0) : id(id) {}
+  int getId() const { return id; }
+};
+
+class World {
+  Entity entities[3];
+public:
+  World() { for (int i = 0; i < 3; i++) entities[i].id = i; }
+  Entity *entity(int i) { return i >= 0 && i < 3 ? &entities[i] : 0; }
+  const Entity &constEntity(int i) const { return entities[i]; }
+  Entity *create(int id) { return new Entity(id); }
+  int sum(Entity *a, const Entity &b) { return a->id + b.id; }
+};
+%}
@@ -0,0 +1,36 @@
+%module lua_flatten_members
+
+// Tested with the -flatten-members option
+
+%inline %{
+
+class Base {
+public:
+  int x;
+  Base() : x(1) {}
+  const char *name() const { return "Base"; }
+  const char *base_only() const { return "Base::base_only"; }
+};
+
+class Other {
+public:
+  int y;
+  Other() : y(2) {}
+  const char *name() const { return "Other"; }
+  const char *other_only() const { return "Other::other_only"; }
+};
+
+class Derived : public Base, public Other {
+public:
+  int z;
+  Derived() : z(3) {}
+  const char *name() const { return "Derived"; }
+};
+
+class MoreDerived : public Derived {
+public:
+  int x;
+  MoreDerived() : x(4) {}
+};
+
+%}
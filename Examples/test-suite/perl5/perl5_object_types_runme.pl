@@ -0,0 +1,32 @@
+use strict;
+use warnings;
+use Test::More tests => 10;
+BEGIN { use_ok('perl5_object_types') }
+require_ok('perl5_object_types');
+
+my $b = perl5_object_types::Base->new();
+my $d = perl5_object_types::Derived->new();
+my $o = perl5_object_types::Other->new();
+
+is(perl5_object_types::baseId($b), 1, "base as base");
+is(perl5_object_types::baseId($d), 2, "derived as base");
+is(perl5_object_types::derivedId($d), 2, "derived as derived");
+
+eval { perl5_object_types::derivedId($b) };
+like($@, qr/\bTypeError\b/, "base as derived");
+eval { perl5_object_types::baseId($o) };
+like($@, qr/\bTypeError\b/, "other as base");
+
+# a pointer returned as a base class is a base class object
+my $db = perl5_object_types::derivedAsBase();
+is(perl5_object_types::baseId($db), 2, "derived returned as base");
+eval { perl5_object_types::derivedId($db) };
+like($@, qr/\bTypeError\b/, "derived returned as base as derived");
+
+# objects of perl subclasses are converted using the wrapped type
+{
+  package MyDerived;
+  our @ISA = ('perl5_object_types::Derived');
+}
+my $md = MyDerived->new();
+is(perl5_object_types::baseId($md), 2, "perl subclass as base");
@@ -0,0 +1,23 @@
+%module perl5_object_types
+
+// Conversion of wrapped objects using the type recorded when they were wrapped
+
+%inline %{
+class Base {
+public:
+  virtual ~Base() {}
+  virtual int id() const { return 1; }
+};
+
+class Derived : public Base {
+public:
+  int id() const { return 2; }
+};
+
+class Other {
+};
+
+int baseId(const Base *b) { return b->id(); }
+int derivedId(const Derived *d) { return d->id(); }
+Base *derivedAsBase() { static Derived d; return &d; }
+%}
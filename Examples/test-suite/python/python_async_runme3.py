@@ -0,0 +1,92 @@
+import asyncio
+import gc
+import sys
+from python_async import *
+
+
+async def main():
+    # Functions return an awaitable future
+    future = async_add(1, 2)
+    if not asyncio.isfuture(future):
+        raise RuntimeError("async_add did not return a future")
+    if await future != 3:
+        raise RuntimeError("async_add")
+
+    results = await asyncio.gather(*[async_add(i, i) for i in range(20)])
+    if results != [2 * i for i in range(20)]:
+        raise RuntimeError("async_add gather")
+
+    if await async_overloaded(5) != 5 or await async_overloaded(5, 6) != 30:
+        raise RuntimeError("async_overloaded")
+
+    # Calls are run by a bounded pool of reused threads
+    waits = await asyncio.gather(*[async_wait(20) for i in range(64)])
+    if waits != [20] * 64:
+        raise RuntimeError("async_wait gather")
+    if not 1 <= await async_threads() <= 8:
+        raise RuntimeError("async_wait used too many threads")
+
+    # Exceptions from the call are raised on awaiting
+    if await async_throw(7) != 7:
+        raise RuntimeError("async_throw")
+    try:
+        await async_throw(-1)
+        raise RuntimeError("async_throw did not throw")
+    except ValueError:
+        pass
+
+    # Arguments are converted before the call returns, so errors are raised immediately
+    try:
+        async_add("one", 2)
+        raise RuntimeError("async_add did not raise TypeError")
+    except TypeError:
+        pass
+    try:
+        async_overloaded("one")
+        raise RuntimeError("async_overloaded did not raise TypeError")
+    except TypeError:
+        pass
+    try:
+        Worker(1).keep(None)
+        raise RuntimeError("Worker.keep did not raise for None")
+    except (TypeError, ValueError):
+        pass
+
+    # Functions without the feature are unaffected
+    if sync_add(1, 2) != 3:
+        raise RuntimeError("sync_add")
+    if module_threads_defined():
+        raise RuntimeError("SWIG_PYTHON_THREADS defined for the module")
+
+    # Member functions, with the arguments kept alive until the call completes
+    w = Worker(3)
+    future = w.scale(4)
+    if await future != 12:
+        raise RuntimeError("Worker.scale")
+    future = Worker(2).keep(Data(11))
+    gc.collect()
+    if await future != 11:
+        raise RuntimeError("Worker.keep")
+
+    # Converted arguments are kept in the frame of the call
+    futures = [Worker(i).name("w" + str(i)) for i in range(10)] + [Worker(2).name("x", i) for i in range(10)]
+    gc.collect()
+    names = await asyncio.gather(*futures)
+    if names != ["w%d%d" % (i, i) for i in range(10)] + ["x%d" % (2 * i) for i in range(10)]:
+        raise RuntimeError("Worker.name " + str(names))
+
+
+# A running event loop is required, before Python 3.7 the current event loop is used instead
+if sys.version_info >= (3, 7):
+    try:
+        async_add(1, 2)
+        raise RuntimeError("async_add without event loop")
+    except RuntimeError as e:
+        if "async_add without event loop" in str(e):
+            raise
+
+loop = asyncio.new_event_loop()
+try:
+    loop.run_until_complete(main())
+finally:
+    loop.close()
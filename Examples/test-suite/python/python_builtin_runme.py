@@ -111,3 +111,41 @@ z = ANumber(9)
 z = pow(x, y, z)
 if z.Value() != 7:
   raise RuntimeError("pow(x, y, z) wrong")
+
+# Test 8 member variable access
+mv = MemberVars()
+mv.i = 10
+mv.d = 1.5
+mv.vs = ValueStruct(20)
+mv.vsp = mv.vs
+if mv.i != 10 or mv.d != 1.5 or mv.vs.value != 20 or mv.vsp.value != 20 or mv.ci != 42:
+  raise RuntimeError("member variables not working")
+mv.vsp = None
+if mv.vsp is not None:
+  raise RuntimeError("member variable set to None not working")
+MemberVars.si = 30
+if MemberVars.si != 30:
+  raise RuntimeError("static member variable not working")
+try:
+  mv.i = "string"
+  raise RuntimeError("Missing TypeError")
+except TypeError:
+  pass
+try:
+  mv.ci = 1
+  raise RuntimeError("Missing AttributeError")
+except AttributeError:
+  pass
+try:
+  del mv.i
+  raise RuntimeError("Missing error deleting member variable")
+except (TypeError, AttributeError):
+  pass
+if mv.i != 10:
+  raise RuntimeError("member variable changed")
+
+# Test 9 member variable setter parsing its argument tuple
+pm = ParsedMember()
+pm.parsed = 5
+if pm.parsed != 5:
+  raise RuntimeError("member variable with parse typemap not working")
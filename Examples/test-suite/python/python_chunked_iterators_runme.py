@@ -0,0 +1,46 @@
+from python_chunked_iterators import *
+
+# Sizes around the chunk size of 3 used by this module
+for n in range(8):
+    v = IntVector(make_vector(n))
+    if list(v) != list(range(n)):
+        raise RuntimeError("list(v) {}".format(list(v)))
+    total = 0
+    for i in v:
+        total += i
+    if total != sum(range(n)):
+        raise RuntimeError("for loop")
+
+    m = StringIntMap(make_map(n))
+    keys = ["k%02d" % i for i in range(n)]
+    if list(m) != keys:
+        raise RuntimeError("list(m) {}".format(list(m)))
+    if list(m.iterkeys()) != keys:
+        raise RuntimeError("iterkeys")
+    if list(m.itervalues()) != list(range(n)):
+        raise RuntimeError("itervalues")
+    if list(m.iteritems()) != list(zip(keys, range(n))):
+        raise RuntimeError("iteritems")
+    if dict(m.iteritems()) != dict(zip(keys, range(n))):
+        raise RuntimeError("dict(m.iteritems())")
+    if m.asdict() != dict(zip(keys, range(n))):
+        raise RuntimeError("asdict")
+
+    s = StringSet(keys)
+    if list(s) != keys:
+        raise RuntimeError("set")
+
+# Iterators keep the container alive and can be abandoned part way
+it = iter(IntVector(make_vector(10)))
+if next(it) != 0 or next(it) != 1:
+    raise RuntimeError("next")
+del it
+
+it = iter(IntVector(make_vector(4)))
+if list(it) != [0, 1, 2, 3] or list(it) != []:
+    raise RuntimeError("exhausted iterator")
+
+# Bulk conversion with the standard iterators
+i = IntVector(make_vector(5)).iterator()
+if i.next_chunk(2) != [0, 1] or i.next_chunk(10) != [2, 3, 4] or i.next_chunk(10) != []:
+    raise RuntimeError("next_chunk")
@@ -0,0 +1,44 @@
+from python_dealloc import *
+
+# Plain destructors are called directly
+p = Plain(1)
+p = None
+if get_plain_deletes() != 1:
+    raise RuntimeError("Plain destructor not called")
+
+# Objects not owned by Python are not deleted
+p = Plain(2)
+q = p.get_self()
+q = None
+if get_plain_deletes() != 1:
+    raise RuntimeError("borrowed Plain deleted")
+p.thisown = 0
+p = None
+if get_plain_deletes() != 1:
+    raise RuntimeError("disowned Plain deleted")
+
+# %exception code on the destructor still runs
+g = Guarded()
+g = None
+if get_guarded_deletes() != 1:
+    raise RuntimeError("%exception not used for Guarded destructor")
+
+# %extend destructors are called
+e = Extended()
+e = None
+if get_extended_deletes() != 1:
+    raise RuntimeError("%extend destructor not called")
+
+# Reuse of deallocated SwigPyObject and SwigPyPacked instances
+for i in range(1000):
+    objs = [Plain(j) for j in range(i % 7 + 1)]
+    for j, o in enumerate(objs):
+        if o.get_self().value != j:
+            raise RuntimeError("wrong value {} for Plain({})".format(o.get_self().value, j))
+    m = plain_method()
+    if call_plain_method(objs[-1], m) != len(objs) - 1:
+        raise RuntimeError("wrong member pointer result")
+objs = None
+o = None
+if get_plain_deletes() != 1 + sum(i % 7 + 1 for i in range(1000)):
+    raise RuntimeError("wrong number of Plain deletes: {}".format(get_plain_deletes()))
@@ -0,0 +1,55 @@
+import sys
+import python_deferinit
+from python_deferinit import *
+
+def is_python_lazy():
+    return sys.version_info >= (3, 7, 0) and not python_deferinit.is_python_builtin()
+
+# Values
+if python_deferinit.LAZY_INT != 42:
+    raise RuntimeError("LAZY_INT")
+if python_deferinit.LAZY_STRING != "lazy":
+    raise RuntimeError("LAZY_STRING")
+if python_deferinit.LAZY_DEFINE != 123:
+    raise RuntimeError("LAZY_DEFINE")
+if python_deferinit.LazyFirst != 1 or python_deferinit.LazySecond != 2:
+    raise RuntimeError("LazyEnum")
+if python_deferinit.lazy_function(21) != 42:
+    raise RuntimeError("lazy_function")
+if python_deferinit.cvar.lazy_global != 10:
+    raise RuntimeError("lazy_global")
+if python_deferinit.LazyClass.LAZY_MEMBER != 7:
+    raise RuntimeError("LAZY_MEMBER")
+if python_deferinit.LazyClass().value() != 7:
+    raise RuntimeError("LazyClass.value")
+if python_deferinit.lazy_instance.value() != 7:
+    raise RuntimeError("lazy_instance")
+
+# Names pulled in by 'import *'
+if LazySecond != 2 or lazy_other_function() != 99:
+    raise RuntimeError("import *")
+
+# Names listed before they are created
+if "LAZY_DEFINE" not in dir(python_deferinit):
+    raise RuntimeError("dir")
+
+try:
+    python_deferinit.no_such_name
+    raise RuntimeError("no_such_name found")
+except AttributeError:
+    pass
+
+if is_python_lazy():
+    # Functions in the extension module are only created on first access
+    lowlevel = python_deferinit._python_deferinit
+    if "LazyClass_value" not in lowlevel.__dict__:
+        raise RuntimeError("LazyClass_value not created")
+    fastproxy = type(python_deferinit.lazy_unused_function).__name__ == "builtin_function_or_method"
+    if not fastproxy and "lazy_unused_function" in lowlevel.__dict__:
+        raise RuntimeError("lazy_unused_function created too early")
+    if "lazy_unused_function" not in dir(lowlevel):
+        raise RuntimeError("lazy_unused_function not in dir")
+    if lowlevel.lazy_unused_function() != 99:
+        raise RuntimeError("lazy_unused_function")
+    if "lazy_unused_function" not in lowlevel.__dict__:
+        raise RuntimeError("lazy_unused_function not cached")
@@ -0,0 +1,87 @@
+from python_director_override import *
+
+
+class Derived(Callback):
+    def __init__(self):
+        Callback.__init__(self)
+        self.calls = 0
+
+    def value(self, i):
+        self.calls += 1
+        return i * 2
+
+
+class Plain(Callback):
+    pass
+
+
+d = Derived()
+for i in range(10):
+    if call_value(d, i) != i * 2:
+        raise RuntimeError("overridden method not called")
+if d.calls != 10:
+    raise RuntimeError("wrong number of calls {}".format(d.calls))
+if call_other(d) != -1:
+    raise RuntimeError("C++ method not called")
+
+p = Plain()
+call_touch(p)
+call_touch(p)
+if p.touched != 2:
+    raise RuntimeError("C++ void method not called")
+if call_value(p, 5) != 5:
+    raise RuntimeError("C++ method not called")
+
+# Classes of builtin types cannot be modified
+if not is_python_builtin():
+    # Methods added to the class after the first call are used
+    Plain.value = lambda self, i: i + 100
+    if call_value(p, 5) != 105:
+        raise RuntimeError("method added to class not called")
+    del Plain.value
+    if call_value(p, 5) != 5:
+        raise RuntimeError("method removed from class still called")
+
+    # Methods replaced in the proxy class itself are used
+    original_value = Callback.value
+    Callback.value = lambda self, i: i + 1000
+    if call_value(p, 5) != 1005:
+        raise RuntimeError("method replaced in proxy class not called")
+    Callback.value = original_value
+    if call_value(p, 5) != 5:
+        raise RuntimeError("C++ method not called after restoring proxy class method")
+
+    # Methods added to a class already overriding other methods are used
+    def other(self):
+        return 42
+    Derived.other = other
+    if call_other(d) != 42:
+        raise RuntimeError("method added to class not called")
+
+# Methods set on an instance are used
+p.other = lambda: 7
+if call_other(p) != 7:
+    raise RuntimeError("method set on instance not called")
+del p.other
+if call_other(p) != -1:
+    raise RuntimeError("method removed from instance still called")
+
+# Proxy methods with %pythonappend or %pythonprepend code are called when not overridden
+
+
+class PlainAppended(Appended):
+    def __init__(self):
+        Appended.__init__(self)
+        self.prepends = 0
+
+
+a = PlainAppended()
+if not is_python_builtin():
+    if call_name(a) != "Appended+appended":
+        raise RuntimeError("%pythonappend code not run {}".format(call_name(a)))
+    call_prepended(a)
+    if a.prepends != 1:
+        raise RuntimeError("%pythonprepend code not run")
+    call_overloaded(a)
+    if a.prepends != 11:
+        raise RuntimeError("%pythonprepend code for overloaded method not run")
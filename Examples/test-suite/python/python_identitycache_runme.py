@@ -0,0 +1,60 @@
+import sys
+from python_identitycache import *
+
+root = Node(1)
+child = Node(2)
+child.setParent(root)
+
+# The proxy created by the constructor is handed back
+if child.parent() is not root:
+    raise RuntimeError("parent() did not return the original proxy")
+if child.get_self() is not child:
+    raise RuntimeError("get_self() did not return the original proxy")
+
+# Borrowed pointers are given a single proxy
+orphan = Node(3)
+if root.parent() is not None:
+    raise RuntimeError("null pointer not returned as None")
+orphan.setParent(child)
+p = orphan.parent()
+if p is not child or p is not orphan.parent():
+    raise RuntimeError("parent() proxies differ")
+
+# Classes without the feature get a new proxy each time
+plain = Plain()
+if plain.get_self() is plain:
+    raise RuntimeError("Plain should not use the identity cache")
+
+# Returns taking ownership always create a new proxy
+c1 = root.clone()
+c2 = root.clone()
+if c1 is c2 or not c1.thisown:
+    raise RuntimeError("clone() should create owned proxies")
+
+# The cache does not keep proxies alive
+n = Node(4)
+if sys.getrefcount(n) != 2:
+    raise RuntimeError("identity cache holds a reference to the proxy")
+
+# Disowning a proxy drops it from the cache
+child.thisown = 0
+other = child.get_self()
+if other is child:
+    raise RuntimeError("disowned proxy returned from the identity cache")
+if child.get_self() is not other:
+    raise RuntimeError("new proxy not cached after disown")
+child.thisown = 1
+other = None
+
+# Ownership transfer through a DISOWN typemap also drops the entry
+adopted = Node(5)
+adopt(adopted)
+if adopted.get_self() is adopted:
+    raise RuntimeError("proxy still cached after ownership transfer")
+
+# Many live proxies, some released
+nodes = [Node(i) for i in range(1000)]
+del nodes[::3]
+for n in nodes:
+    if n.get_self() is not n:
+        raise RuntimeError("lost proxy for Node({})".format(n.value))
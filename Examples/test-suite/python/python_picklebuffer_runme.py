@@ -0,0 +1,53 @@
+import copy
+import pickle
+import sys
+from python_picklebuffer import *
+
+def check(a, b):
+    if type(a) != type(b) or list(a) != list(b):
+        raise RuntimeError("mismatch: {} {}".format(list(a), list(b)))
+
+d = DoubleVector([1.5, -2.25, 3.0, 1e300])
+i = IntVector([1, -2, 3, 2147483647])
+
+for protocol in range(pickle.HIGHEST_PROTOCOL + 1):
+    for v in (d, i, DoubleVector(), IntVector()):
+        check(v, pickle.loads(pickle.dumps(v, protocol)))
+
+check(d, copy.copy(d))
+check(d, copy.deepcopy(d))
+
+state = d.__reduce_ex__(2)[2]
+if len(state) != 4 * 8:
+    raise RuntimeError("unexpected state size {}".format(len(state)))
+
+if pickle.HIGHEST_PROTOCOL >= 5:
+    # Out-of-band buffers reference the vector memory directly
+    buffers = []
+    data = pickle.dumps(d, protocol=5, buffer_callback=buffers.append)
+    if len(buffers) != 1:
+        raise RuntimeError("expected one out-of-band buffer")
+    raw = buffers[0].raw()
+    if not raw.readonly or raw.nbytes != 4 * 8:
+        raise RuntimeError("unexpected buffer")
+    check(d, pickle.loads(data, buffers=buffers))
+
+    # The buffer keeps the vector alive
+    v = DoubleVector([4.0, 5.0])
+    buffers = []
+    data = pickle.dumps(v, protocol=5, buffer_callback=buffers.append)
+    del v
+    check(DoubleVector([4.0, 5.0]), pickle.loads(data, buffers=buffers))
+
+    # State from a mutable buffer
+    v = DoubleVector()
+    v.__setstate__(bytearray(d.__reduce_ex__(2)[2]))
+    check(d, v)
+    if sum(v) != sum(d):
+        raise RuntimeError("sum")
+
+try:
+    DoubleVector().__setstate__(b"123")
+    raise RuntimeError("bad size not detected")
+except ValueError:
+    pass
@@ -0,0 +1,90 @@
+%module python_async
+
+%feature("async") async_add;
+%feature("async") async_overloaded;
+%feature("async") async_throw;
+%feature("async") Worker::scale;
+%feature("async") Worker::keep;
+%feature("async") Worker::name;
+%feature("async") async_wait;
+%feature("async") async_threads;
+
+%include <exception.i>
+%include <std_string.i>
+
+%exception async_throw {
+  try {
+    $action
+  } catch (int e) {
+    SWIG_exception(SWIG_ValueError, "async_throw failed");
+  }
+}
+
+// Thread support is not turned on for the module, only the asynchronous functions release the GIL
+%{
+static bool module_threads_defined() {
+#if defined(SWIG_PYTHON_THREADS)
+  return true;
+#else
+  return false;
+#endif
+}
+%}
+bool module_threads_defined();
+
+// Blocks for a while, recording the number of distinct threads making the calls
+%{
+#if __cplusplus >= 201103L
+#include <set>
+#include <thread>
+#include <mutex>
+#include <chrono>
+static std::mutex async_mutex;
+static std::set<std::thread::id> async_thread_ids;
+int async_wait(int ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  std::lock_guard<std::mutex> lock(async_mutex);
+  async_thread_ids.insert(std::this_thread::get_id());
+  return ms;
+}
+int async_threads() {
+  std::lock_guard<std::mutex> lock(async_mutex);
+  return (int)async_thread_ids.size();
+}
+#else
+int async_wait(int ms) { return ms; }
+int async_threads() { return 1; }
+#endif
+%}
+int async_wait(int ms);
+int async_threads();
+
+%inline %{
+int async_add(int a, int b) { return a + b; }
+
+int async_overloaded(int a) { return a; }
+int async_overloaded(int a, int b) { return a * b; }
+
+int async_throw(int a) {
+  if (a < 0)
+    throw a;
+  return a;
+}
+
+int sync_add(int a, int b) { return a + b; }
+
+struct Data {
+  int value;
+  Data(int value) : value(value) {}
+};
+
+class Worker {
+  int factor;
+public:
+  Worker(int factor) : factor(factor) {}
+  int scale(int i) const { return i * factor; }
+  int keep(const Data &data) const { return data.value; }
+  std::string name(const std::string &prefix) const { return prefix + std::to_string(factor); }
+  std::string name(const std::string &prefix, int i) const { return prefix + std::to_string(factor * i); }
+};
+%}
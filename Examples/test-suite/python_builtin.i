@@ -245,3 +245,28 @@ public:
 };
 %}
 
+
+// Test 8 member variable access
+%inline %{
+struct MemberVars {
+  int i;
+  double d;
+  ValueStruct vs;
+  ValueStruct *vsp;
+  const int ci;
+  static int si;
+  MemberVars() : i(0), d(0.0), vs(0), vsp(0), ci(42) {}
+};
+int MemberVars::si = 0;
+%}
+
+// Test 9 member variable setter parsing its argument tuple
+#ifdef SWIGPYTHON_BUILTIN
+%typemap(in, parse="i") int parsed "";
+#endif
+%inline %{
+struct ParsedMember {
+  int parsed;
+  ParsedMember() : parsed(0) {}
+};
+%}
@@ -0,0 +1,4 @@
+%module python_builtin_nofastunpack
+
+// python_builtin using the argument tuple calling convention (-nofastunpack)
+%include "python_builtin.i"
@@ -0,0 +1,35 @@
+%module python_chunked_iterators
+
+%begin %{
+#define SWIG_PYTHON_ITERATOR_CHUNK_SIZE 3
+%}
+
+#define SWIG_PYTHON_CHUNKED_ITERATORS
+
+%include <std_string.i>
+%include <std_vector.i>
+%include <std_set.i>
+%include <std_map.i>
+
+%template(IntVector) std::vector<int>;
+%template(StringSet) std::set<std::string>;
+%template(StringIntMap) std::map<std::string, int>;
+
+%inline %{
+std::vector<int> make_vector(int n) {
+  std::vector<int> v;
+  for (int i = 0; i < n; ++i)
+    v.push_back(i);
+  return v;
+}
+
+std::map<std::string, int> make_map(int n) {
+  std::map<std::string, int> m;
+  for (int i = 0; i < n; ++i) {
+    char key[16];
+    sprintf(key, "k%02d", i);
+    m[key] = i;
+  }
+  return m;
+}
+%}
@@ -0,0 +1,46 @@
+%module python_dealloc
+
+/*
+ Owned objects are deleted by calling the C++ destructor directly when a proxy is
+ garbage collected, unless the destructor wrapper does more than a plain delete.
+ Deallocated SwigPyObject and SwigPyPacked instances are reused by later objects.
+*/
+
+%exception Guarded::~Guarded %{
+  guarded_deletes++;
+  $action
+%}
+
+%extend Extended {
+  ~Extended() {
+    extended_deletes++;
+    delete $self;
+  }
+}
+
+%inline %{
+int plain_deletes = 0;
+int guarded_deletes = 0;
+int extended_deletes = 0;
+int get_plain_deletes() { return plain_deletes; }
+int get_guarded_deletes() { return guarded_deletes; }
+int get_extended_deletes() { return extended_deletes; }
+
+struct Plain {
+  Plain(int value = 0) : value(value) {}
+  ~Plain() { plain_deletes++; }
+  int value;
+  Plain *get_self() { return this; }
+  int get_value() const { return value; }
+};
+
+struct Guarded {
+};
+
+struct Extended {
+};
+
+typedef int (Plain::*PlainMethod)() const;
+PlainMethod plain_method() { return &Plain::get_value; }
+int call_plain_method(const Plain &p, PlainMethod m) { return (p.*m)(); }
+%}
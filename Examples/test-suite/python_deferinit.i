@@ -0,0 +1,31 @@
+%module(deferinit="1") python_deferinit
+
+%constant int LAZY_INT = 42;
+%constant const char *LAZY_STRING = "lazy";
+
+%inline %{
+#define LAZY_DEFINE 123
+enum LazyEnum { LazyFirst = 1, LazySecond = 2 };
+
+int lazy_function(int i) { return i * 2; }
+int lazy_other_function() { return 99; }
+
+int lazy_global = 10;
+
+struct LazyClass {
+  static const int LAZY_MEMBER = 7;
+  int value() const { return LAZY_MEMBER; }
+};
+
+const LazyClass lazy_instance = LazyClass();
+%}
+
+%inline %{
+int lazy_unused_function() { return 99; }
+
+#ifdef SWIGPYTHON_BUILTIN
+bool is_python_builtin() { return true; }
+#else
+bool is_python_builtin() { return false; }
+#endif
+%}
@@ -0,0 +1,57 @@
+%module(directors="1") python_director_override
+
+/*
+ Director methods call the C++ method directly when the Python class does not
+ override it. Check the override check follows changes to the Python class and
+ to the instance.
+*/
+
+%include <std_string.i>
+
+%feature("director") Callback;
+%feature("director") Appended;
+
+// Proxy methods with Python code of their own are always called
+%pythonappend Appended::name %{
+    val = val + "+appended"
+%}
+%pythonprepend Appended::prepended %{
+    self.prepends += 1
+%}
+%pythonprepend Appended::overloaded(double) %{
+    self.prepends += 10
+%}
+
+%inline %{
+#ifdef SWIGPYTHON_BUILTIN
+bool is_python_builtin() { return true; }
+#else
+bool is_python_builtin() { return false; }
+#endif
+
+struct Callback {
+  virtual ~Callback() {}
+  virtual int value(int i) { return i; }
+  virtual int other() { return -1; }
+  virtual void touch() { touched++; }
+  int touched;
+  Callback() : touched(0) {}
+};
+
+#include <string>
+
+struct Appended {
+  virtual ~Appended() {}
+  virtual std::string name() { return "Appended"; }
+  virtual void prepended() {}
+  virtual void overloaded(int) {}
+  virtual void overloaded(double) {}
+};
+
+int call_value(Callback *cb, int i) { return cb->value(i); }
+int call_other(Callback *cb) { return cb->other(); }
+void call_touch(Callback *cb) { cb->touch(); }
+std::string call_name(Appended *a) { return a->name(); }
+void call_prepended(Appended *a) { a->prepended(); }
+void call_overloaded(Appended *a) { a->overloaded(1); }
+%}
@@ -0,0 +1,33 @@
+%module python_identitycache
+
+/*
+ Use the %pythonidentitycache directive to make the wrapped class return the
+ same proxy object every time the same C/C++ pointer is returned.
+*/
+
+%pythonidentitycache Node;
+%newobject Node::clone;
+%apply SWIGTYPE *DISOWN { Node *disowned };
+
+%inline %{
+struct Node {
+  Node(int value = 0) : value(value), parent_(0) {}
+  int value;
+  Node *parent() { return parent_; }
+  void setParent(Node *p) { parent_ = p; }
+  Node *get_self() { return this; }
+  Node *clone() const { return new Node(value); }
+private:
+  Node *parent_;
+};
+
+struct Plain {
+  Plain *get_self() { return this; }
+};
+
+void adopt(Node *disowned) {
+  static Node *adopted_node = 0;
+  delete adopted_node;
+  adopted_node = disowned;
+}
+%}
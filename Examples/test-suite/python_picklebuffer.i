@@ -0,0 +1,18 @@
+%module python_picklebuffer
+
+%include <std_vector.i>
+
+%pythonpicklebuffer(std::vector<double>)
+%pythonpicklebuffer(std::vector<int>)
+
+%template(DoubleVector) std::vector<double>;
+%template(IntVector) std::vector<int>;
+
+%inline %{
+double sum(const std::vector<double> &v) {
+  double total = 0;
+  for (size_t i = 0; i < v.size(); ++i)
+    total += v[i];
+  return total;
+}
+%}
@@ -0,0 +1,42 @@
+#!/usr/bin/env ruby
+#
+# Put description here
+#
+
+require 'swig_assert'
+
+require 'ruby_nogvl'
+
+include Ruby_nogvl
+
+swig_assert_equal('add(2, 3)', '5', binding)
+swig_assert_equal('concat("ab", "cd")', '"abcd"', binding)
+
+p = make_point(1, 2)
+swig_assert_equal('p.x', '1', binding)
+swig_assert_equal('p.y', '2', binding)
+
+swig_assert_equal('check_positive(4)', '4', binding)
+begin
+  check_positive(-1)
+  raise RuntimeError, "check_positive(-1) did not raise"
+rescue ArgumentError => e
+  swig_assert_equal('e.message', '"negative"', binding)
+end
+
+# The GVL is released while waiting, so the main thread can open the gate
+g = Gate.new
+swig_assert_equal('g.value', '0', binding)
+waiter = Thread.new { g.wait(30) }
+sleep 0.1
+g.open
+swig_assert_equal('waiter.value', 'true', binding)
+swig_assert_equal('g.value', '1', binding)
+
+# Killing the thread calls the unblocking function
+g = Gate.new
+waiter = Thread.new { g.wait_interruptible(30) }
+sleep 0.1
+waiter.kill
+waiter.join
+swig_assert_equal('g.was_interrupted', 'true', binding)
@@ -0,0 +1,70 @@
+#!/usr/bin/env ruby
+#
+# Object tracking with many objects, objects of different classes at the
+# same address and objects moved by GC.compact
+#
+
+require 'swig_assert'
+
+require 'ruby_track_objects_compact'
+
+include Ruby_track_objects_compact
+
+def check_items(container, items, when_)
+  items.each_with_index do |item, i|
+    if not item.equal?(container.get(i))
+      raise "Item #{i} should be the same Ruby object #{when_}"
+    end
+  end
+end
+
+# Growing the trackings allocates, which can run a compacting garbage
+# collection while the trackings are being grown. This is done first,
+# while the trackings of Item are still small.
+if GC.respond_to?(:auto_compact=)
+  container = Container.new(200)
+  keep = []
+  auto_compact = GC.auto_compact
+  begin
+    GC.auto_compact = true
+    GC.stress = true
+    200.times { |i| keep << container.get(i) }
+  ensure
+    GC.stress = false
+    GC.auto_compact = auto_compact
+  end
+  check_items(container, keep, "after growing during compaction")
+  keep = nil
+  container = nil
+  GC.start
+end
+
+N = 10000
+container = Container.new(N)
+items = (0...N).map { |i| container.get(i) }
+swig_assert_equal('$SWIG_TRACKINGS_COUNT >= N', 'true', binding)
+swig_assert_equal('items[1234].value', '1234', binding)
+check_items(container, items, "")
+
+# Each class has its own trackings, so the same address can be
+# tracked for both an Outer and the Inner at the start of it
+outer = Outer.new
+inner = outer.get_inner
+if not inner.equal?(outer.get_inner)
+  raise "Inner should be the same Ruby object"
+end
+swig_assert_equal('outer.get_inner.class', 'Inner', binding)
+
+# The trackings are updated when objects are moved
+GC.compact if GC.respond_to?(:compact)
+check_items(container, items, "after GC.compact")
+if not inner.equal?(outer.get_inner)
+  raise "Inner should be the same Ruby object after GC.compact"
+end
+
+# The trackings are removed when the Ruby objects are freed
+count = $SWIG_TRACKINGS_COUNT
+items = nil
+GC.start
+swig_assert_equal('$SWIG_TRACKINGS_COUNT < count', 'true', binding)
+swig_assert_equal('container.get(5).value', '5', binding)
@@ -0,0 +1,68 @@
+%module ruby_nogvl
+
+%include <std_string.i>
+%include <std_except.i>
+
+%feature("nogvl") add;
+%feature("nogvl") concat;
+%feature("nogvl") make_point;
+%feature("nogvl") check_positive;
+%feature("nogvl") Gate::value;
+%feature("nogvl") Gate::wait;
+%feature("nogvl", ubf="Gate_interrupt", ubfdata="arg1") Gate::wait_interruptible;
+
+%catches(std::invalid_argument) check_positive;
+
+%inline %{
+#include <stdexcept>
+#include <string>
+#include <time.h>
+
+int add(int a, int b) { return a + b; }
+
+std::string concat(const std::string &a, const std::string &b) { return a + b; }
+
+struct Point {
+  int x, y;
+};
+
+Point make_point(int x, int y) {
+  Point p;
+  p.x = x;
+  p.y = y;
+  return p;
+}
+
+int check_positive(int i) {
+  if (i < 0)
+    throw std::invalid_argument("negative");
+  return i;
+}
+
+/* wait() only sees open() called from another Ruby thread if the GVL was released */
+class Gate {
+  volatile int opened;
+  int interrupted;
+public:
+  Gate() : opened(0), interrupted(0) {}
+  int value() const { return opened; }
+  void open() { opened = 1; }
+  bool wait(int seconds) {
+    time_t end = time(0) + seconds;
+    while (!opened && time(0) < end) {
+    }
+    return opened != 0;
+  }
+  bool wait_interruptible(int seconds) {
+    return wait(seconds);
+  }
+  bool was_interrupted() const { return interrupted != 0; }
+  friend void Gate_interrupt(void *);
+};
+
+void Gate_interrupt(void *gate) {
+  Gate *g = (Gate *)gate;
+  g->interrupted = 1;
+  g->opened = 1;
+}
+%}
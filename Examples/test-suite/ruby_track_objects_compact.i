@@ -0,0 +1,40 @@
+%module ruby_track_objects_compact
+
+%trackobjects Item;
+%trackobjects Outer;
+%trackobjects Inner;
+
+%inline %{
+#include <vector>
+
+class Item {
+  int value_;
+public:
+  Item(int value) : value_(value) {}
+  int value() const { return value_; }
+};
+
+class Container {
+  std::vector<Item *> items_;
+public:
+  Container(int n) {
+    for (int i = 0; i < n; i++)
+      items_.push_back(new Item(i));
+  }
+  ~Container() {
+    for (size_t i = 0; i < items_.size(); i++)
+      delete items_[i];
+  }
+  Item *get(int i) { return items_[i]; }
+};
+
+/* An Inner is at the same address as the Outer containing it */
+struct Inner {
+  int i;
+};
+
+struct Outer {
+  Inner inner;
+  Inner *get_inner() { return &inner; }
+};
+%}
@@ -0,0 +1,80 @@
+/* -----------------------------------------------------------------------------
+ * csblittable.i
+ *
+ * SWIG blittable struct feature and typemaps implementation providing:
+ *   %csblittable
+ *
+ * The C# proxy for a class marked with %csblittable is a value type, a struct
+ * with the StructLayout(LayoutKind.Sequential) attribute whose fields are the
+ * C++ member variables. No C++ object is allocated for it, it has no finalizer
+ * and it is passed to and from C++ by reference or by value, without copying
+ * or conversion by the P/Invoke marshaller. The C++ class must be trivially
+ * copyable, must not have base classes or virtual methods, and its member
+ * variables must all be public and of types with the same representation in
+ * C# and C++: signed char, unsigned char, short, unsigned short, int,
+ * unsigned int, long long, unsigned long long, float, double, enums and other
+ * blittable classes. Usage:
+ *
+ *   %include <csblittable.i>
+ *   %csblittable(Vec3)
+ *   struct Vec3 { double x, y, z; };
+ *
+ * Pointers and references to the struct are passed to C++ as pointers to the
+ * C# struct, which is pinned for the duration of the call only. Non-const
+ * pointers and references are ref parameters in C#. Pointers and references
+ * returned from C++, const or not, are copied into a new C# struct, so changes
+ * to the returned struct are not seen by the C++ object it was copied from.
+ * A null pointer returned from C++ throws a NullReferenceException.
+ * ----------------------------------------------------------------------------- */
+
+%define %csblittable(CTYPE...)
+%feature("csblittable") CTYPE;
+
+%typemap(csattributes) CTYPE "[global::System.Runtime.InteropServices.StructLayout(global::System.Runtime.InteropServices.LayoutKind.Sequential)]"
+%typemap(csclassmodifiers) CTYPE "public struct"
+%typemap(csinterfaces) CTYPE ""
+%typemap(csbody) CTYPE ""
+%typemap(csfinalize) CTYPE ""
+%typemap(csdestruct) CTYPE ""
+
+%typemap(ctype, out="CTYPE") CTYPE "void *"
+%typemap(ctype) CTYPE *, CTYPE &, CTYPE [] "void *"
+%typemap(imtype, out="$&csclassname") CTYPE "ref $&csclassname"
+%typemap(imtype, out="global::System.IntPtr") CTYPE *, CTYPE & "ref $csclassname"
+%typemap(imtype, inattributes="[global::System.Runtime.InteropServices.In, global::System.Runtime.InteropServices.Out]") CTYPE [] "$csclassname[]"
+%typemap(imtype) const CTYPE [] "$csclassname[]"
+%typemap(cstype) CTYPE "$&csclassname"
+%typemap(cstype) const CTYPE *, const CTYPE & "$csclassname"
+%typemap(cstype, out="$csclassname") CTYPE *, CTYPE & "ref $csclassname"
+%typemap(cstype) CTYPE [] "$csclassname[]"
+
+%typemap(in) CTYPE %{ $1 = *($&1_ltype)$input; %}
+%typemap(in) CTYPE *, CTYPE &, CTYPE [] %{ $1 = ($1_ltype)$input; %}
+%typemap(out) CTYPE %{ $result = $1; %}
+%typemap(out) CTYPE *, CTYPE & %{ $result = (void *)$1; %}
+
+%typemap(csin) CTYPE, CTYPE *, CTYPE & "ref $csinput"
+%typemap(csin) CTYPE [] "$csinput"
+%typemap(csout, excode=SWIGEXCODE) CTYPE {
+    $&csclassname ret = $imcall;$excode
+    return ret;
+  }
+%typemap(csout, excode=SWIGEXCODE) CTYPE *, CTYPE & {
+    global::System.IntPtr cPtr = $imcall;$excode
+    if (cPtr == global::System.IntPtr.Zero)
+      throw new global::System.NullReferenceException("Unexpected null return for type $csclassname");
+    return ($csclassname)global::System.Runtime.InteropServices.Marshal.PtrToStructure(cPtr, typeof($csclassname));
+  }
+%typemap(csvarout, excode=SWIGEXCODE2) CTYPE %{
+    get {
+      $&csclassname ret = $imcall;$excode
+      return ret;
+    } %}
+%typemap(csvarout, excode=SWIGEXCODE2) CTYPE *, CTYPE & %{
+    get {
+      global::System.IntPtr cPtr = $imcall;$excode
+      if (cPtr == global::System.IntPtr.Zero)
+        throw new global::System.NullReferenceException("Unexpected null return for type $csclassname");
+      return ($csclassname)global::System.Runtime.InteropServices.Marshal.PtrToStructure(cPtr, typeof($csclassname));
+    } %}
+%enddef
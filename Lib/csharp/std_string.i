@@ -107,5 +107,18 @@ class string;
 %{ SWIG_CSharpSetPendingException(SWIG_CSharpApplicationException, $1.c_str());
    return $null; %}
 
+#if defined(SWIG_CSHARP_UTF8_STRINGS)
+// UTF-8 marshalling without the string callback, see the char * typemaps in csharp.swg
+%typemap(imtype,
+         inattributes="[global::System.Runtime.InteropServices.MarshalAs(global::System.Runtime.InteropServices.UnmanagedType.LPUTF8Str)]",
+         outattributes="[return: global::System.Runtime.InteropServices.MarshalAs(global::System.Runtime.InteropServices.UnmanagedType.LPUTF8Str)]",
+         directorinattributes="[global::System.Runtime.InteropServices.MarshalAs(global::System.Runtime.InteropServices.UnmanagedType.LPUTF8Str)]",
+         directoroutattributes="[return: global::System.Runtime.InteropServices.MarshalAs(global::System.Runtime.InteropServices.UnmanagedType.LPUTF8Str)]"
+         ) string, const string & "string"
+%typemap(out) string %{ $result = SWIG_csharp_string_return($1.c_str()); %}
+%typemap(out) const string & %{ $result = SWIG_csharp_string_return($1->c_str()); %}
+%typemap(directorin) string, const string & %{ $input = (char *)$1.c_str(); %}
+#endif
+
 }
 
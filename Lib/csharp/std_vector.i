@@ -22,8 +22,8 @@
 
 %include <std_common.i>
 
-// MACRO for use within the std::vector class body
-%define SWIG_STD_VECTOR_MINIMUM_INTERNAL(CSINTERFACE, CONST_REFERENCE, CTYPE...)
+// MACRO for use within the std::vector class body, everything except CopyTo(int, CTYPE[], int, int)
+%define SWIG_STD_VECTOR_COMMON_INTERNAL(CSINTERFACE, CONST_REFERENCE, CTYPE...)
 %typemap(csinterfaces) std::vector< CTYPE > "global::System.IDisposable, global::System.Collections.IEnumerable\n    , global::System.Collections.Generic.CSINTERFACE<$typemap(cstype, CTYPE)>\n";
 %proxycode %{
   public $csclassname(global::System.Collections.IEnumerable c) : this() {
@@ -96,24 +96,6 @@
     CopyTo(0, array, arrayIndex, this.Count);
   }
 
-  public void CopyTo(int index, $typemap(cstype, CTYPE)[] array, int arrayIndex, int count)
-  {
-    if (array == null)
-      throw new global::System.ArgumentNullException("array");
-    if (index < 0)
-      throw new global::System.ArgumentOutOfRangeException("index", "Value is less than zero");
-    if (arrayIndex < 0)
-      throw new global::System.ArgumentOutOfRangeException("arrayIndex", "Value is less than zero");
-    if (count < 0)
-      throw new global::System.ArgumentOutOfRangeException("count", "Value is less than zero");
-    if (array.Rank > 1)
-      throw new global::System.ArgumentException("Multi dimensional array.", "array");
-    if (index+count > this.Count || arrayIndex+count > array.Length)
-      throw new global::System.ArgumentException("Number of elements to copy is too large.");
-    for (int i=0; i<count; i++)
-      array.SetValue(getitemcopy(index+i), arrayIndex+i);
-  }
-
   public $typemap(cstype, CTYPE)[] ToArray() {
     $typemap(cstype, CTYPE)[] array = new $typemap(cstype, CTYPE)[this.Count];
     this.CopyTo(array);
@@ -313,6 +295,30 @@
     }
 %enddef
 
+// MACRO for use within the std::vector class body
+%define SWIG_STD_VECTOR_MINIMUM_INTERNAL(CSINTERFACE, CONST_REFERENCE, CTYPE...)
+SWIG_STD_VECTOR_COMMON_INTERNAL(CSINTERFACE, %arg(CONST_REFERENCE), %arg(CTYPE))
+%proxycode %{
+  public void CopyTo(int index, $typemap(cstype, CTYPE)[] array, int arrayIndex, int count)
+  {
+    if (array == null)
+      throw new global::System.ArgumentNullException("array");
+    if (index < 0)
+      throw new global::System.ArgumentOutOfRangeException("index", "Value is less than zero");
+    if (arrayIndex < 0)
+      throw new global::System.ArgumentOutOfRangeException("arrayIndex", "Value is less than zero");
+    if (count < 0)
+      throw new global::System.ArgumentOutOfRangeException("count", "Value is less than zero");
+    if (array.Rank > 1)
+      throw new global::System.ArgumentException("Multi dimensional array.", "array");
+    if (index+count > this.Count || arrayIndex+count > array.Length)
+      throw new global::System.ArgumentException("Number of elements to copy is too large.");
+    for (int i=0; i<count; i++)
+      array.SetValue(getitemcopy(index+i), arrayIndex+i);
+  }
+%}
+%enddef
+
 // Extra methods added to the collection class if operator== is defined for the class being wrapped
 // The class will then implement IList<>, which adds extra functionality
 %define SWIG_STD_VECTOR_EXTRA_OP_EQUALS_EQUALS(CTYPE...)
@@ -345,6 +351,135 @@
     }
 %enddef
 
+// Bulk copying between the std::vector and C# arrays, for element types whose C# type is blittable and has the
+// same representation as the C++ type. Each copy is a single call into the native code on pinned memory.
+// Methods using Span<$typemap(cstype, CTYPE)> are added if SWIG_CSHARP_SPAN is defined and require C# 7.3 and compiling with -unsafe.
+%define SWIG_STD_VECTOR_BLITTABLE_INTERNAL(CTYPE...)
+%proxycode %{
+  public void CopyTo(int index, $typemap(cstype, CTYPE)[] array, int arrayIndex, int count)
+  {
+    if (array == null)
+      throw new global::System.ArgumentNullException("array");
+    if (index < 0)
+      throw new global::System.ArgumentOutOfRangeException("index", "Value is less than zero");
+    if (arrayIndex < 0)
+      throw new global::System.ArgumentOutOfRangeException("arrayIndex", "Value is less than zero");
+    if (count < 0)
+      throw new global::System.ArgumentOutOfRangeException("count", "Value is less than zero");
+    if (index+count > this.Count || arrayIndex+count > array.Length)
+      throw new global::System.ArgumentException("Number of elements to copy is too large.");
+    if (count > 0) {
+      global::System.Runtime.InteropServices.GCHandle handle = global::System.Runtime.InteropServices.GCHandle.Alloc(array, global::System.Runtime.InteropServices.GCHandleType.Pinned);
+      try {
+        copyitemsto(index, count, global::System.Runtime.InteropServices.Marshal.UnsafeAddrOfPinnedArrayElement(array, arrayIndex));
+      } finally {
+        handle.Free();
+      }
+    }
+  }
+
+  // Overwrites count elements starting at index with the elements in array starting at arrayIndex
+  public void CopyFrom(int index, $typemap(cstype, CTYPE)[] array, int arrayIndex, int count)
+  {
+    if (array == null)
+      throw new global::System.ArgumentNullException("array");
+    if (index < 0)
+      throw new global::System.ArgumentOutOfRangeException("index", "Value is less than zero");
+    if (arrayIndex < 0)
+      throw new global::System.ArgumentOutOfRangeException("arrayIndex", "Value is less than zero");
+    if (count < 0)
+      throw new global::System.ArgumentOutOfRangeException("count", "Value is less than zero");
+    if (index+count > this.Count || arrayIndex+count > array.Length)
+      throw new global::System.ArgumentException("Number of elements to copy is too large.");
+    if (count > 0) {
+      global::System.Runtime.InteropServices.GCHandle handle = global::System.Runtime.InteropServices.GCHandle.Alloc(array, global::System.Runtime.InteropServices.GCHandleType.Pinned);
+      try {
+        copyitemsfrom(index, count, global::System.Runtime.InteropServices.Marshal.UnsafeAddrOfPinnedArrayElement(array, arrayIndex));
+      } finally {
+        handle.Free();
+      }
+    }
+  }
+
+  // Replaces all the elements with the elements in values
+  public void Assign($typemap(cstype, CTYPE)[] values)
+  {
+    if (values == null)
+      throw new global::System.ArgumentNullException("values");
+    if (values.Length == 0) {
+      assignitems(0, global::System.IntPtr.Zero);
+      return;
+    }
+    global::System.Runtime.InteropServices.GCHandle handle = global::System.Runtime.InteropServices.GCHandle.Alloc(values, global::System.Runtime.InteropServices.GCHandleType.Pinned);
+    try {
+      assignitems(values.Length, handle.AddrOfPinnedObject());
+    } finally {
+      handle.Free();
+    }
+  }
+%}
+#if defined(SWIG_CSHARP_SPAN)
+%proxycode %{
+  public unsafe void CopyTo(global::System.Span<$typemap(cstype, CTYPE)> destination)
+  {
+    int count = this.Count;
+    if (count > destination.Length)
+      throw new global::System.ArgumentException("Number of elements to copy is too large.");
+    fixed ($typemap(cstype, CTYPE)* p = destination) {
+      copyitemsto(0, count, (global::System.IntPtr)p);
+    }
+  }
+
+  public unsafe void CopyFrom(int index, global::System.ReadOnlySpan<$typemap(cstype, CTYPE)> source)
+  {
+    if (index < 0)
+      throw new global::System.ArgumentOutOfRangeException("index", "Value is less than zero");
+    if (index+source.Length > this.Count)
+      throw new global::System.ArgumentException("Number of elements to copy is too large.");
+    fixed ($typemap(cstype, CTYPE)* p = source) {
+      copyitemsfrom(index, source.Length, (global::System.IntPtr)p);
+    }
+  }
+
+  public unsafe void Assign(global::System.ReadOnlySpan<$typemap(cstype, CTYPE)> values)
+  {
+    fixed ($typemap(cstype, CTYPE)* p = values) {
+      assignitems(values.Length, (global::System.IntPtr)p);
+    }
+  }
+
+  // A view of the vector's memory, which is no longer valid once the vector is resized, reallocated or disposed
+  public unsafe global::System.Span<$typemap(cstype, CTYPE)> AsSpan()
+  {
+    return new global::System.Span<$typemap(cstype, CTYPE)>((void *)itemsaddress(), this.Count);
+  }
+%}
+#endif
+
+    %apply void *VOID_INT_PTR { CTYPE *swigbuffer, CTYPE const *swigbuffer, CTYPE *itemsaddress }
+    %extend {
+      void copyitemsto(int index, int count, CTYPE *swigbuffer) throw (std::out_of_range) {
+        if (index < 0 || count < 0 || index > (int)$self->size() - count)
+          throw std::out_of_range("index");
+        std::copy($self->begin()+index, $self->begin()+index+count, swigbuffer);
+      }
+      void copyitemsfrom(int index, int count, CTYPE const *swigbuffer) throw (std::out_of_range) {
+        if (index < 0 || count < 0 || index > (int)$self->size() - count)
+          throw std::out_of_range("index");
+        std::copy(swigbuffer, swigbuffer+count, $self->begin()+index);
+      }
+      void assignitems(int count, CTYPE const *swigbuffer) throw (std::out_of_range) {
+        if (count < 0)
+          throw std::out_of_range("count");
+        $self->assign(swigbuffer, swigbuffer+count);
+      }
+      CTYPE *itemsaddress() {
+        return $self->empty() ? 0 : &(*$self)[0];
+      }
+    }
+    %clear CTYPE *swigbuffer, CTYPE const *swigbuffer, CTYPE *itemsaddress;
+%enddef
+
 // Macros for std::vector class specializations/enhancements
 %define SWIG_STD_VECTOR_ENHANCED(CTYPE...)
 namespace std {
@@ -355,6 +490,16 @@ namespace std {
 }
 %enddef
 
+%define SWIG_STD_VECTOR_BLITTABLE(CTYPE...)
+namespace std {
+  template<> class vector< CTYPE > {
+    SWIG_STD_VECTOR_COMMON_INTERNAL(IList, %arg(CTYPE const&), %arg(CTYPE))
+    SWIG_STD_VECTOR_EXTRA_OP_EQUALS_EQUALS(CTYPE)
+    SWIG_STD_VECTOR_BLITTABLE_INTERNAL(CTYPE)
+  };
+}
+%enddef
+
 // Legacy macros
 %define SWIG_STD_VECTOR_SPECIALIZE(CSTYPE, CTYPE...)
 #warning SWIG_STD_VECTOR_SPECIALIZE macro deprecated, please see csharp/std_vector.i and switch to SWIG_STD_VECTOR_ENHANCED
@@ -377,6 +522,10 @@ SWIG_STD_VECTOR_ENHANCED(CTYPE)
 %csmethodmodifiers std::vector::size "private"
 %csmethodmodifiers std::vector::capacity "private"
 %csmethodmodifiers std::vector::reserve "private"
+%csmethodmodifiers std::vector::copyitemsto "private"
+%csmethodmodifiers std::vector::copyitemsfrom "private"
+%csmethodmodifiers std::vector::assignitems "private"
+%csmethodmodifiers std::vector::itemsaddress "private"
 
 namespace std {
   // primary (unspecialized) class template for std::vector
@@ -399,18 +548,19 @@ namespace std {
 // template specializations for std::vector
 // these provide extra collections methods as operator== is defined
 SWIG_STD_VECTOR_ENHANCED(char)
-SWIG_STD_VECTOR_ENHANCED(signed char)
-SWIG_STD_VECTOR_ENHANCED(unsigned char)
-SWIG_STD_VECTOR_ENHANCED(short)
-SWIG_STD_VECTOR_ENHANCED(unsigned short)
-SWIG_STD_VECTOR_ENHANCED(int)
-SWIG_STD_VECTOR_ENHANCED(unsigned int)
 SWIG_STD_VECTOR_ENHANCED(long)
 SWIG_STD_VECTOR_ENHANCED(unsigned long)
-SWIG_STD_VECTOR_ENHANCED(long long)
-SWIG_STD_VECTOR_ENHANCED(unsigned long long)
-SWIG_STD_VECTOR_ENHANCED(float)
-SWIG_STD_VECTOR_ENHANCED(double)
+// these also provide bulk copying as the C# type has the same size as the C++ type
+SWIG_STD_VECTOR_BLITTABLE(signed char)
+SWIG_STD_VECTOR_BLITTABLE(unsigned char)
+SWIG_STD_VECTOR_BLITTABLE(short)
+SWIG_STD_VECTOR_BLITTABLE(unsigned short)
+SWIG_STD_VECTOR_BLITTABLE(int)
+SWIG_STD_VECTOR_BLITTABLE(unsigned int)
+SWIG_STD_VECTOR_BLITTABLE(long long)
+SWIG_STD_VECTOR_BLITTABLE(unsigned long long)
+SWIG_STD_VECTOR_BLITTABLE(float)
+SWIG_STD_VECTOR_BLITTABLE(double)
 SWIG_STD_VECTOR_ENHANCED(std::string) // also requires a %include <std_string.i>
 SWIG_STD_VECTOR_ENHANCED(std::wstring) // also requires a %include <std_wstring.i>
 
@@ -1,19 +1,31 @@
 /* -----------------------------------------------------------------------------
  * std_vector.i
+ *
+ * Vectors of the arithmetic types whose Go type has the same size as the C++
+ * type have these additional methods, each of which is a single cgo call:
+ *   View() []T       - slice aliasing the vector's elements, valid only until
+ *                      the vector is modified or destroyed
+ *   CopyTo([]T) int  - copies the leading elements into a Go slice
+ *   Assign([]T)      - replaces the contents with a copy of a Go slice
+ * std::vector<std::string> has Assign([]string) and ToSlice() []string.
  * ----------------------------------------------------------------------------- */
 
 %{
 #include <vector>
 #include <stdexcept>
+
+// Elements of a vector returned to Go as a slice.
+template <typename T> struct SwigGoSlice {
+  T *array;
+  size_t len;
+};
 %}
 
-namespace std {
-    
-    template<class T> class vector {
+%define SWIG_STD_VECTOR_MINIMUM_INTERNAL(CTYPE, CONST_REFERENCE)
       public:
         typedef size_t size_type;
-        typedef T value_type;
-        typedef const value_type& const_reference;
+        typedef CTYPE value_type;
+        typedef CONST_REFERENCE const_reference;
         vector();
         vector(size_type n);
         size_type size() const;
@@ -40,38 +52,193 @@ namespace std {
                     throw std::out_of_range("vector index out of range");
             }
         }
+%enddef
+
+// Go slice access for the element types with the same size in Go and C++.
+%define SWIG_STD_VECTOR_SLICE_INTERNAL(CTYPE, GOTYPE)
+        %typemap(gotype) SwigGoSlice< CTYPE > "[]GOTYPE"
+        %typemap(out) SwigGoSlice< CTYPE >
+        %{
+  $result.array = (void *)$1.array;
+  $result.len = (intgo)$1.len;
+  $result.cap = $result.len;
+        %}
+        %typemap(gotype) (CTYPE *swigslice, size_t swiglen), (const CTYPE *swigslice, size_t swiglen) "[]GOTYPE"
+        %typemap(in) (CTYPE *swigslice, size_t swiglen), (const CTYPE *swigslice, size_t swiglen)
+        %{
+  $1 = ($1_ltype)$input.array;
+  $2 = (size_t)$input.len;
+        %}
+        %extend {
+            SwigGoSlice< CTYPE > view() {
+                SwigGoSlice< CTYPE > s;
+                s.array = self->empty() ? 0 : &(*self)[0];
+                s.len = self->size();
+                return s;
+            }
+            int copyTo(CTYPE *swigslice, size_t swiglen) {
+                size_t n = swiglen < self->size() ? swiglen : self->size();
+                if (n > 0)
+                    memcpy(swigslice, &(*self)[0], n * sizeof(CTYPE));
+                return int(n);
+            }
+            void assign(const CTYPE *swigslice, size_t swiglen) {
+                self->assign(swigslice, swigslice + swiglen);
+            }
+        }
+%enddef
+
+// A []string is passed to C++ packed into a single []int holding the number
+// of strings, the length of each string and then the bytes, as cgo does not
+// allow passing Go memory containing Go pointers. Strings are returned in a
+// C array of Go strings pointing at the vector's data, which the Go code
+// copies before freeing the array.
+// A []byte of n bytes at p. Unlike a conversion to a pointer to a fixed size
+// array, such as *[1<<30]byte, the length is not limited.
+%fragment("ByteSlice", "go_runtime") %{
+type swig_goslice struct { p unsafe.Pointer; n int; c int }
+func swigByteSlice(p unsafe.Pointer, n int) (b []byte) {
+	h := (*swig_goslice)(unsafe.Pointer(&b))
+	h.p = p
+	h.n = n
+	h.c = n
+	return
+}
+%}
+
+%typemap(gotype) std::vector< std::string > &swigstrings "[]string"
+%typemap(imtype) std::vector< std::string > &swigstrings "[]int"
+%typemap(goin,fragment="ByteSlice") std::vector< std::string > &swigstrings
+%{
+	{
+		n := len($input)
+		total := 0
+		for _, s := range $input {
+			total += len(s)
+		}
+		size := int(unsafe.Sizeof(n))
+		words := 1 + n + (total + size - 1) / size
+		$result = make([]int, words)
+		$result[0] = n
+		b := swigByteSlice(unsafe.Pointer(&$result[0]), words * size)[(1 + n) * size:]
+		off := 0
+		for i, s := range $input {
+			$result[1 + i] = len(s)
+			off += copy(b[off:], s)
+		}
+	}
+%}
+%typemap(in) std::vector< std::string > &swigstrings ($*1_ltype temp)
+%{
+  {
+    const intgo *p = (const intgo *)$input.array;
+    intgo n = p[0];
+    const char *bytes = (const char *)(p + 1 + n);
+    temp.resize((size_t)n);
+    for (intgo i = 0; i < n; i++) {
+      temp[i].assign(bytes, (size_t)p[1 + i]);
+      bytes += p[1 + i];
+    }
+    $1 = &temp;
+  }
+%}
+
+%typemap(gotype) SwigGoSlice< std::string > "[]string"
+%typemap(out) SwigGoSlice< std::string >
+%{
+  $result.array = 0;
+  $result.len = (intgo)$1.len;
+  $result.cap = $result.len;
+  if ($1.len > 0) {
+    _gostring_ *a = (_gostring_ *)malloc($1.len * sizeof(_gostring_));
+    for (size_t i = 0; i < $1.len; i++) {
+      a[i].p = (char *)$1.array[i].data();
+      a[i].n = (intgo)$1.array[i].size();
+    }
+    $result.array = a;
+  }
+%}
+%typemap(goout,fragment="CopyString",fragment="ByteSlice") SwigGoSlice< std::string >
+%{
+	$result = make([]string, len($1))
+	for i := range $1 {
+		p := *(*swig_gostring)(unsafe.Pointer(&$1[i]))
+		$result[i] = string(swigByteSlice(unsafe.Pointer(p.p), p.n))
+	}
+	if len($1) > 0 {
+		Swig_free(uintptr(unsafe.Pointer(&$1[0])))
+	}
+%}
+
+namespace std {
+
+    template<class T> class vector {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(T, const T&)
     };
 
     // bool specialization
     template<> class vector<bool> {
-      public:
-        typedef size_t size_type;
-        typedef bool value_type;
-        typedef bool const_reference;
-        vector();
-        vector(size_type n);
-        size_type size() const;
-        size_type capacity() const;
-        void reserve(size_type n);
-        %rename(isEmpty) empty;
-        bool empty() const;
-        void clear();
-        %rename(add) push_back;
-        void push_back(const value_type& x);
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(bool, bool)
+    };
+
+    // specializations with Go slice access
+    template<> class vector<signed char> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(signed char, const signed char&)
+        SWIG_STD_VECTOR_SLICE_INTERNAL(signed char, int8)
+    };
+    template<> class vector<unsigned char> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(unsigned char, const unsigned char&)
+        SWIG_STD_VECTOR_SLICE_INTERNAL(unsigned char, byte)
+    };
+    template<> class vector<char> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(char, const char&)
+        SWIG_STD_VECTOR_SLICE_INTERNAL(char, byte)
+    };
+    template<> class vector<short> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(short, const short&)
+        SWIG_STD_VECTOR_SLICE_INTERNAL(short, int16)
+    };
+    template<> class vector<unsigned short> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(unsigned short, const unsigned short&)
+        SWIG_STD_VECTOR_SLICE_INTERNAL(unsigned short, uint16)
+    };
+    template<> class vector<int> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(int, const int&)
+        SWIG_STD_VECTOR_SLICE_INTERNAL(int, int32)
+    };
+    template<> class vector<unsigned int> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(unsigned int, const unsigned int&)
+        SWIG_STD_VECTOR_SLICE_INTERNAL(unsigned int, uint32)
+    };
+    template<> class vector<long long> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(long long, const long long&)
+        SWIG_STD_VECTOR_SLICE_INTERNAL(long long, int64)
+    };
+    template<> class vector<unsigned long long> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(unsigned long long, const unsigned long long&)
+        SWIG_STD_VECTOR_SLICE_INTERNAL(unsigned long long, uint64)
+    };
+    template<> class vector<float> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(float, const float&)
+        SWIG_STD_VECTOR_SLICE_INTERNAL(float, float32)
+    };
+    template<> class vector<double> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(double, const double&)
+        SWIG_STD_VECTOR_SLICE_INTERNAL(double, float64)
+    };
+
+    // string specialization with []string conversion
+    template<> class vector<std::string> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(std::string, const std::string&)
         %extend {
-            bool get(int i) throw (std::out_of_range) {
-                int size = int(self->size());
-                if (i>=0 && i<size)
-                    return (*self)[i];
-                else
-                    throw std::out_of_range("vector index out of range");
+            void assign(std::vector< std::string > &swigstrings) {
+                self->swap(swigstrings);
             }
-            void set(int i, const value_type& val) throw (std::out_of_range) {
-                int size = int(self->size());
-                if (i>=0 && i<size)
-                    (*self)[i] = val;
-                else
-                    throw std::out_of_range("vector index out of range");
+            SwigGoSlice< std::string > toSlice() {
+                SwigGoSlice< std::string > s;
+                s.array = self->empty() ? 0 : &(*self)[0];
+                s.len = self->size();
+                return s;
             }
         }
     };
@@ -228,6 +228,81 @@ JAVA_ARRAYS_TYPEMAPS(double, double, jdouble, Double, "[D")     /* double[ANY] *
     ""
 
 
+/* Pinning approach
+ * ----------------
+ * Array typemaps using GetPrimitiveArrayCritical. Instead of copying the array elements
+ * into a separately allocated C array, the C/C++ function is passed a pointer to the
+ * elements of the Java array, which most JVMs provide without copying. These are not used
+ * by default and are applied to the array or pointer parameters, where the C/C++ type has
+ * the same representation as the Java type, using the following names:
+ *
+ *   CTYPE CRITICAL[]       - changes made by the function are kept in the Java array
+ *   CTYPE CRITICAL_INPUT[] - for input only arrays, any changes are discarded by releasing
+ *                            the elements with JNI_ABORT, which also avoids the copy back
+ *                            on JVMs that copy the elements
+ *
+ * Example usage:
+ *
+ *   %include <arrays_java.i>
+ *   %apply double CRITICAL_INPUT[] { const double *source }
+ *   %apply double CRITICAL[] { double *target }
+ *   void scale(const double *source, double *target, int nitems, double factor);
+ *
+ * The garbage collector may be blocked while the elements are held, so these typemaps are
+ * only suitable for short calls that do not block. The elements are acquired in the check
+ * typemap, after all the parameters have been converted, and are released in the freearg
+ * typemap, after the return value has been converted. The function must not call back into
+ * Java and should return void or a primitive type. No JNI function may be called while the
+ * elements are held, so the code raising a Java exception for a C++ exception must release
+ * them first using $cleanup, for example:
+ *
+ *   %exception scale {
+ *     try {
+ *       $action
+ *     } catch (std::exception &e) {
+ *       $cleanup
+ *       SWIG_JavaThrowException(jenv, SWIG_JavaRuntimeException, e.what());
+ *       return $null;
+ *     }
+ *   }
+ *
+ * A null array results in a NullPointerException. */
+%define JAVA_ARRAYS_CRITICAL(CTYPE, JTYPE, JNITYPE)
+
+%typemap(jni) CTYPE CRITICAL[], CTYPE CRITICAL_INPUT[]        %{JNITYPE##Array%}
+%typemap(jtype) CTYPE CRITICAL[], CTYPE CRITICAL_INPUT[]      %{JTYPE[]%}
+%typemap(jstype) CTYPE CRITICAL[], CTYPE CRITICAL_INPUT[]     %{JTYPE[]%}
+%typemap(javain) CTYPE CRITICAL[], CTYPE CRITICAL_INPUT[]     "$javainput"
+
+%typemap(in) CTYPE CRITICAL[], CTYPE CRITICAL_INPUT[]
+%{  if (!$input) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+    return $null;
+  } %}
+%typemap(check) CTYPE CRITICAL[], CTYPE CRITICAL_INPUT[]
+%{  $1 = ($1_ltype) JCALL2(GetPrimitiveArrayCritical, jenv, $input, 0);
+  if (!$1) {
+    $cleanup
+    return $null;
+  } %}
+%typemap(argout) CTYPE CRITICAL[], CTYPE CRITICAL_INPUT[] ""
+%typemap(freearg) CTYPE CRITICAL[]
+%{ if ($1) JCALL3(ReleasePrimitiveArrayCritical, jenv, $input, (void *)$1, 0); %}
+%typemap(freearg) CTYPE CRITICAL_INPUT[]
+%{ if ($1) JCALL3(ReleasePrimitiveArrayCritical, jenv, $input, (void *)$1, JNI_ABORT); %}
+
+%typemap(typecheck) CTYPE CRITICAL[] = CTYPE[];
+%typemap(typecheck) CTYPE CRITICAL_INPUT[] = CTYPE[];
+%enddef
+
+JAVA_ARRAYS_CRITICAL(signed char, byte, jbyte)
+JAVA_ARRAYS_CRITICAL(short, short, jshort)
+JAVA_ARRAYS_CRITICAL(int, int, jint)
+JAVA_ARRAYS_CRITICAL(long long, long, jlong)
+JAVA_ARRAYS_CRITICAL(float, float, jfloat)
+JAVA_ARRAYS_CRITICAL(double, double, jdouble)
+
+
 /* Arrays of proxy classes. The typemaps in this macro make it possible to treat an array of 
  * class/struct/unions as an array of Java classes. 
  * Use the following macro to use these typemaps for an array of class/struct/unions called name:
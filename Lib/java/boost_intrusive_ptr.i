@@ -309,6 +309,16 @@
     super.delete();
   }
 
+#if defined(SWIG_JAVA_CLEANER)
+// Smart pointer proxies are not registered with the cleaner and are still released by a finalizer
+%typemap(javafinalize) TYPE %{
+  protected void finalize() {
+    delete();
+  }
+%}
+%typemap(javacleanup) TYPE ""
+#endif
+
 // CONST version needed ???? also for C#
 %typemap(jtype, nopgcpp="1") SWIG_SHARED_PTR_QNAMESPACE::shared_ptr< TYPE > swigSharedPtrUpcast "long"
 %typemap(jtype, nopgcpp="1") SWIG_SHARED_PTR_QNAMESPACE::shared_ptr< CONST TYPE > swigSharedPtrUpcast "long"
@@ -463,6 +473,16 @@
     super.delete();
   }
 
+#if defined(SWIG_JAVA_CLEANER)
+// Smart pointer proxies are not registered with the cleaner and are still released by a finalizer
+%typemap(javafinalize) TYPE %{
+  protected void finalize() {
+    delete();
+  }
+%}
+%typemap(javacleanup) TYPE ""
+#endif
+
 // CONST version needed ???? also for C#
 %typemap(jtype, nopgcpp="1") SWIG_SHARED_PTR_QNAMESPACE::shared_ptr< TYPE > swigSharedPtrUpcast "long"
 %typemap(jtype, nopgcpp="1") SWIG_SHARED_PTR_QNAMESPACE::shared_ptr< CONST TYPE > swigSharedPtrUpcast "long"
@@ -299,6 +299,16 @@
     super.delete();
   }
 
+#if defined(SWIG_JAVA_CLEANER)
+// Smart pointer proxies are not registered with the cleaner and are still released by a finalizer
+%typemap(javafinalize) TYPE %{
+  protected void finalize() {
+    delete();
+  }
+%}
+%typemap(javacleanup) TYPE ""
+#endif
+
 %typemap(directordisconnect, methodname="swigDirectorDisconnect") TYPE %{
   protected void $methodname() {
     swigSetCMemOwn(false);
@@ -7,12 +7,67 @@
  * To use non-const std::string references use the following %apply.  Note 
  * that they are passed by value.
  * %apply const std::string & {std::string &};
+ *
+ * The default typemaps convert between modified UTF-8 and the Java String
+ * encoding. For binary data, or large strings that do not need to be Java
+ * Strings, the following typemaps copy the bytes without any conversion:
+ *
+ * BYTES - a Java byte[], for example:
+ *   %apply std::string BYTES { std::string serialize };
+ *   %apply const std::string &BYTES { const std::string &message };
+ *   std::string serialize(const std::string &message);
+ *
+ * NIOBUFFER - a direct java.nio.ByteBuffer. The bytes between the buffer's
+ * position and limit are copied when passed to C++. A std::string returned by
+ * value is copied into a new direct ByteBuffer. A const std::string & return is
+ * not copied, instead a read-only ByteBuffer viewing the string's bytes is
+ * returned. The view is only valid while the string exists and is not
+ * modified, for example while the Java proxy owning the C++ object containing
+ * the string is still reachable.
  * ----------------------------------------------------------------------------- */
 
 %{
 #include <string>
 %}
 
+%fragment("SWIG_JavaNewDirectByteBuffer", "header") {
+#include <string.h>
+/* Create a direct java.nio.ByteBuffer containing a copy of size bytes of data */
+SWIGINTERN jobject SWIG_JavaNewDirectByteBuffer(JNIEnv *jenv, const char *data, size_t size) {
+  /* Looked up on first use. Threads racing on the first lookup can at worst create an
+     extra global reference to the class. Both are checked before use, so a thread never
+     uses one of them before the other has been set. */
+  static jclass clazz = 0;
+  static jmethodID allocate_direct = 0;
+  jclass cls_ref = clazz;
+  jmethodID method = allocate_direct;
+  if (size > 0x7fffffff) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaIndexOutOfBoundsException, "string too large for a java.nio.ByteBuffer");
+    return 0;
+  }
+  if (!cls_ref || !method) {
+    jclass cls = jenv->FindClass("java/nio/ByteBuffer");
+    if (!cls)
+      return 0;
+    method = jenv->GetStaticMethodID(cls, "allocateDirect", "(I)Ljava/nio/ByteBuffer;");
+    if (!method) {
+      jenv->DeleteLocalRef(cls);
+      return 0;
+    }
+    cls_ref = (jclass)jenv->NewGlobalRef(cls);
+    jenv->DeleteLocalRef(cls);
+    if (!cls_ref)
+      return 0;
+    clazz = cls_ref;
+    allocate_direct = method;
+  }
+  jobject buffer = jenv->CallStaticObjectMethod(cls_ref, method, (jint)size);
+  if (buffer && size > 0)
+    memcpy(jenv->GetDirectBufferAddress(buffer), data, size);
+  return buffer;
+}
+}
+
 namespace std {
 
 %naturalvar string;
@@ -117,5 +172,105 @@ class string;
 %{ SWIG_JavaThrowException(jenv, SWIG_JavaRuntimeException, $1.c_str());
    return $null; %}
 
+// string BYTES, const string &BYTES
+%typemap(jni) string BYTES, const string &BYTES "jbyteArray"
+%typemap(jtype) string BYTES, const string &BYTES "byte[]"
+%typemap(jstype) string BYTES, const string &BYTES "byte[]"
+%typemap(javadirectorin) string BYTES, const string &BYTES "$jniinput"
+%typemap(javadirectorout) string BYTES "$javacall"
+
+%typemap(in) string BYTES
+%{ if(!$input) {
+     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+     return $null;
+   }
+   $1.resize(jenv->GetArrayLength($input));
+   if (!$1.empty())
+     jenv->GetByteArrayRegion($input, 0, (jsize)$1.size(), (jbyte *)&$1[0]); %}
+
+%typemap(in) const string &BYTES
+%{ if(!$input) {
+     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+     return $null;
+   }
+   $*1_ltype $1_str(jenv->GetArrayLength($input), '\0');
+   if (!$1_str.empty())
+     jenv->GetByteArrayRegion($input, 0, (jsize)$1_str.size(), (jbyte *)&$1_str[0]);
+   $1 = &$1_str; %}
+
+%typemap(directorout) string BYTES
+%{ if(!$input) {
+     if (!jenv->ExceptionCheck()) {
+       SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+     }
+     return $null;
+   }
+   $result.resize(jenv->GetArrayLength($input));
+   if (!$result.empty())
+     jenv->GetByteArrayRegion($input, 0, (jsize)$result.size(), (jbyte *)&$result[0]); %}
+
+%typemap(directorin,descriptor="[B") string BYTES, const string &BYTES
+%{ $input = jenv->NewByteArray((jsize)$1.size());
+   if (!$input) return $null;
+   jenv->SetByteArrayRegion($input, 0, (jsize)$1.size(), (const jbyte *)$1.data());
+   Swig::LocalRefGuard $1_refguard(jenv, $input); %}
+
+%typemap(out) string BYTES
+%{ $result = jenv->NewByteArray((jsize)$1.size());
+   if ($result && !$1.empty())
+     jenv->SetByteArrayRegion($result, 0, (jsize)$1.size(), (const jbyte *)$1.data()); %}
+
+%typemap(out) const string &BYTES
+%{ $result = jenv->NewByteArray((jsize)$1->size());
+   if ($result && !$1->empty())
+     jenv->SetByteArrayRegion($result, 0, (jsize)$1->size(), (const jbyte *)$1->data()); %}
+
+%typemap(javain) string BYTES, const string &BYTES "$javainput"
+
+%typemap(javaout) string BYTES, const string &BYTES {
+    return $jnicall;
+  }
+
+%typecheck(SWIG_TYPECHECK_INT8_ARRAY) string BYTES, const string &BYTES ""
+
+// string NIOBUFFER, const string &NIOBUFFER
+%typemap(jni) string NIOBUFFER, const string &NIOBUFFER "jobject"
+%typemap(jtype) string NIOBUFFER, const string &NIOBUFFER "java.nio.ByteBuffer"
+%typemap(jstype) string NIOBUFFER, const string &NIOBUFFER "java.nio.ByteBuffer"
+
+%typemap(in) string NIOBUFFER
+%{ const char *$1_pbuf = (const char *)jenv->GetDirectBufferAddress($input);
+   if (!$1_pbuf) {
+     SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "Unable to get address of a java.nio.ByteBuffer direct byte buffer. Buffer must be a direct buffer and not a non-direct buffer.");
+     return $null;
+   }
+   $1.assign($1_pbuf, (size_t)jenv->GetDirectBufferCapacity($input)); %}
+
+%typemap(in) const string &NIOBUFFER
+%{ const char *$1_pbuf = (const char *)jenv->GetDirectBufferAddress($input);
+   if (!$1_pbuf) {
+     SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "Unable to get address of a java.nio.ByteBuffer direct byte buffer. Buffer must be a direct buffer and not a non-direct buffer.");
+     return $null;
+   }
+   $*1_ltype $1_str($1_pbuf, (size_t)jenv->GetDirectBufferCapacity($input));
+   $1 = &$1_str; %}
+
+%typemap(out, fragment="SWIG_JavaNewDirectByteBuffer") string NIOBUFFER
+%{ $result = SWIG_JavaNewDirectByteBuffer(jenv, $1.data(), $1.size()); %}
+
+%typemap(out) const string &NIOBUFFER
+%{ $result = jenv->NewDirectByteBuffer((void *)$1->data(), (jlong)$1->size()); %}
+
+// slice() passes just the bytes between the position and limit, as the buffer's capacity
+%typemap(javain) string NIOBUFFER, const string &NIOBUFFER "$javainput.slice()"
+
+%typemap(javaout) string NIOBUFFER {
+    return $jnicall;
+  }
+
+%typemap(javaout) const string &NIOBUFFER {
+    return $jnicall.asReadOnlyBuffer();
+  }
+
 }
 
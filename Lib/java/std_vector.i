@@ -163,12 +163,97 @@ SWIGINTERN jint SWIG_VectorSize(size_t size) {
     }
 %enddef
 
+/* Bulk copying between a std::vector and a Java primitive array, and a direct buffer view of the vector's
+ * memory, for the element types whose Java type has the same representation as the C++ type */
+%define SWIG_STD_VECTOR_PRIMITIVE_ARRAY_INTERNAL(CTYPE, JNITYPE, JNINAME, JBUFFER, JBUFFERVIEW)
+%proxycode %{
+  public $typemap(jstype, CTYPE)[] toArray($typemap(jstype, CTYPE)[] a) {
+    int size = size();
+    if (a.length < size)
+      a = new $typemap(jstype, CTYPE)[size];
+    doGetRange(0, a, 0, size);
+    return a;
+  }
+
+  public void assign($typemap(jstype, CTYPE)[] values) {
+    modCount++;
+    doAssign(values);
+  }
+
+  public void getRange(int index, $typemap(jstype, CTYPE)[] dest, int offset, int length) {
+    doGetRange(index, dest, offset, length);
+  }
+
+  public void setRange(int index, $typemap(jstype, CTYPE)[] src, int offset, int length) {
+    doSetRange(index, src, offset, length);
+  }
+
+  public java.nio.JBUFFER asDirectBuffer() {
+    java.nio.ByteBuffer buffer = (java.nio.ByteBuffer)doDirectBuffer();
+    return buffer.order(java.nio.ByteOrder.nativeOrder()).JBUFFERVIEW;
+  }
+%}
+
+    // The JNIEnv of the wrapper is passed to these helpers only, the typemap is cleared again below
+    %apply JNIEnv *SWIG_STD_VECTOR_JNIENV { JNIEnv *JNIENV };
+
+    %extend {
+      void doAssign(JNIEnv *JNIENV, JNITYPE##Array values) {
+        if (!values) {
+          SWIG_JavaThrowException(JNIENV, SWIG_JavaNullPointerException, "null array");
+          return;
+        }
+        jsize length = JNIENV->GetArrayLength(values);
+        self->resize(length);
+        if (length > 0)
+          JNIENV->Get##JNINAME##ArrayRegion(values, 0, length, (JNITYPE *)&(*self)[0]);
+      }
+
+      void doGetRange(JNIEnv *JNIENV, jint index, JNITYPE##Array dest, jint offset, jint length) throw (std::out_of_range) {
+        if (!dest) {
+          SWIG_JavaThrowException(JNIENV, SWIG_JavaNullPointerException, "null array");
+          return;
+        }
+        jint size = static_cast<jint>(self->size());
+        if (index < 0 || length < 0 || index > size - length)
+          throw std::out_of_range("vector index out of range");
+        if (length > 0)
+          JNIENV->Set##JNINAME##ArrayRegion(dest, offset, length, (const JNITYPE *)&(*self)[index]);
+      }
+
+      void doSetRange(JNIEnv *JNIENV, jint index, JNITYPE##Array src, jint offset, jint length) throw (std::out_of_range) {
+        if (!src) {
+          SWIG_JavaThrowException(JNIENV, SWIG_JavaNullPointerException, "null array");
+          return;
+        }
+        jint size = static_cast<jint>(self->size());
+        if (index < 0 || length < 0 || index > size - length)
+          throw std::out_of_range("vector index out of range");
+        if (length > 0)
+          JNIENV->Get##JNINAME##ArrayRegion(src, offset, length, (JNITYPE *)&(*self)[index]);
+      }
+
+      jobject doDirectBuffer(JNIEnv *JNIENV) {
+        static CTYPE empty;
+        return JNIENV->NewDirectByteBuffer(self->empty() ? &empty : &(*self)[0], (jlong)(self->size() * sizeof(CTYPE)));
+      }
+    }
+
+    %clear JNIEnv *JNIENV;
+%enddef
+
+%typemap(in, numinputs=0) JNIEnv *SWIG_STD_VECTOR_JNIENV "$1 = jenv;"
+
 %javamethodmodifiers std::vector::doSize        "private";
 %javamethodmodifiers std::vector::doAdd         "private";
 %javamethodmodifiers std::vector::doGet         "private";
 %javamethodmodifiers std::vector::doSet         "private";
 %javamethodmodifiers std::vector::doRemove      "private";
 %javamethodmodifiers std::vector::doRemoveRange "private";
+%javamethodmodifiers std::vector::doAssign      "private";
+%javamethodmodifiers std::vector::doGetRange    "private";
+%javamethodmodifiers std::vector::doSetRange    "private";
+%javamethodmodifiers std::vector::doDirectBuffer "private";
 
 namespace std {
 
@@ -180,6 +265,32 @@ namespace std {
     template<> class vector<bool> {
         SWIG_STD_VECTOR_MINIMUM_INTERNAL(bool, bool)
     };
+
+    // specializations with bulk primitive array access
+    template<> class vector<signed char> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(signed char, const signed char&)
+        SWIG_STD_VECTOR_PRIMITIVE_ARRAY_INTERNAL(signed char, jbyte, Byte, ByteBuffer, slice().order(java.nio.ByteOrder.nativeOrder()))
+    };
+    template<> class vector<short> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(short, const short&)
+        SWIG_STD_VECTOR_PRIMITIVE_ARRAY_INTERNAL(short, jshort, Short, ShortBuffer, asShortBuffer())
+    };
+    template<> class vector<int> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(int, const int&)
+        SWIG_STD_VECTOR_PRIMITIVE_ARRAY_INTERNAL(int, jint, Int, IntBuffer, asIntBuffer())
+    };
+    template<> class vector<long long> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(long long, const long long&)
+        SWIG_STD_VECTOR_PRIMITIVE_ARRAY_INTERNAL(long long, jlong, Long, LongBuffer, asLongBuffer())
+    };
+    template<> class vector<float> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(float, const float&)
+        SWIG_STD_VECTOR_PRIMITIVE_ARRAY_INTERNAL(float, jfloat, Float, FloatBuffer, asFloatBuffer())
+    };
+    template<> class vector<double> {
+        SWIG_STD_VECTOR_MINIMUM_INTERNAL(double, const double&)
+        SWIG_STD_VECTOR_PRIMITIVE_ARRAY_INTERNAL(double, jdouble, Double, DoubleBuffer, asDoubleBuffer())
+    };
 }
 
 %define specialize_std_vector(T)
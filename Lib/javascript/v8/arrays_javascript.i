@@ -123,3 +123,52 @@
 
   $result = array;
 }
+
+/* -----------------------------------------------------------------------------
+ * Typed arrays
+ *
+ * The TYPEDARRAY typemaps take a typed array of the same element type, e.g. a
+ * Float64Array for double, and pass its elements to C/C++ without copying them.
+ * They are available for pointer and length pairs and for fixed size arrays:
+ *
+ *   %apply (double *TYPEDARRAY, size_t LENGTH) { (const double *values, size_t count) };
+ *   %apply double TYPEDARRAY[ANY] { double matrix[16] };
+ *
+ * A fixed size array is returned as a new typed array holding a copy of it.
+ * ----------------------------------------------------------------------------- */
+
+%define SWIG_TYPEDARRAY_TYPEMAPS(CTYPE, ARRAY)
+%typemap(in, fragment="SWIGV8_TypedArray") (CTYPE *TYPEDARRAY, size_t LENGTH), (const CTYPE *TYPEDARRAY, size_t LENGTH) {
+  if (!$input->Is##ARRAY()) {
+    SWIG_exception_fail(SWIG_TypeError, "in method '" "$symname" "', argument " "$argnum" " is not a " #ARRAY);
+  }
+  size_t length;
+  $1 = ($1_ltype)SWIGV8_TypedArrayData($input, &length);
+  $2 = ($2_ltype)length;
+}
+
+%typemap(in, fragment="SWIGV8_TypedArray") CTYPE TYPEDARRAY[ANY] {
+  if (!$input->Is##ARRAY()) {
+    SWIG_exception_fail(SWIG_TypeError, "in method '" "$symname" "', argument " "$argnum" " is not a " #ARRAY);
+  }
+  size_t length;
+  $1 = ($1_ltype)SWIGV8_TypedArrayData($input, &length);
+  if (length != $1_dim0) {
+    SWIG_exception_fail(SWIG_ValueError, "in method '" "$symname" "', argument " "$argnum" " does not have $1_dim0 elements");
+  }
+}
+// the elements belong to the typed array
+%typemap(freearg) CTYPE TYPEDARRAY[ANY] ""
+%typemap(out, fragment="SWIGV8_TypedArray") CTYPE TYPEDARRAY[ANY] {
+  $result = v8::ARRAY::New(SWIGV8_NewArrayBuffer($1, sizeof(CTYPE) * $1_dim0), 0, $1_dim0);
+}
+%enddef
+
+SWIG_TYPEDARRAY_TYPEMAPS(signed char, Int8Array)
+SWIG_TYPEDARRAY_TYPEMAPS(unsigned char, Uint8Array)
+SWIG_TYPEDARRAY_TYPEMAPS(short, Int16Array)
+SWIG_TYPEDARRAY_TYPEMAPS(unsigned short, Uint16Array)
+SWIG_TYPEDARRAY_TYPEMAPS(int, Int32Array)
+SWIG_TYPEDARRAY_TYPEMAPS(unsigned int, Uint32Array)
+SWIG_TYPEDARRAY_TYPEMAPS(float, Float32Array)
+SWIG_TYPEDARRAY_TYPEMAPS(double, Float64Array)
@@ -79,6 +79,82 @@ namespace std {
     };
 }
 
+/* -----------------------------------------------------------------------------
+ * Typed arrays for vectors of arithmetic types
+ *
+ * The TYPEDARRAY typemaps map std::vector<T> and const std::vector<T>& to a
+ * typed array of the same element type, e.g. std::vector<double> to a
+ * Float64Array, instead of a wrapped vector:
+ *
+ *   %apply std::vector<double> TYPEDARRAY { std::vector<double> };
+ *   %apply const std::vector<double> &TYPEDARRAY { const std::vector<double> & };
+ *
+ * A typed array passed in is copied into the vector with a single memcpy. With
+ * V8 8 and later, a vector returned by value is moved to the heap and becomes
+ * the backing store of the returned array, so its elements are not copied.
+ * ----------------------------------------------------------------------------- */
+
+%fragment("SWIGV8_VectorArrayBuffer", "header", fragment="SWIGV8_TypedArray") %{
+#if (V8_MAJOR_VERSION-0) >= 8
+template <typename T> void SWIGV8_DeleteVector(void *, size_t, void *vector) {
+  delete static_cast<std::vector<T> *>(vector);
+}
+#endif
+
+/**
+ * Creates an ArrayBuffer with the elements of a vector, taking them from the
+ * vector when the buffer can own them.
+ */
+template <typename T> v8::Local<v8::ArrayBuffer> SWIGV8_VectorArrayBuffer(std::vector<T> &v) {
+#if (V8_MAJOR_VERSION-0) >= 8
+  if (!v.empty()) {
+    std::vector<T> *owner = new std::vector<T>();
+    owner->swap(v);
+    std::unique_ptr<v8::BackingStore> store = v8::ArrayBuffer::NewBackingStore(&(*owner)[0], owner->size() * sizeof(T), SWIGV8_DeleteVector<T>, owner);
+    return v8::ArrayBuffer::New(v8::Isolate::GetCurrent(), std::move(store));
+  }
+#endif
+  return SWIGV8_NewArrayBuffer(v.empty() ? 0 : &v[0], v.size() * sizeof(T));
+}
+%}
+
+%define SWIG_STD_VECTOR_TYPEDARRAY(CTYPE, ARRAY)
+%typemap(in, fragment="SWIGV8_TypedArray") std::vector< CTYPE > TYPEDARRAY {
+  if (!$input->Is##ARRAY()) {
+    SWIG_exception_fail(SWIG_TypeError, "in method '" "$symname" "', argument " "$argnum" " is not a " #ARRAY);
+  }
+  size_t length;
+  CTYPE *data = (CTYPE *)SWIGV8_TypedArrayData($input, &length);
+  $1 = std::vector< CTYPE >(data, data + length);
+}
+%typemap(in, fragment="SWIGV8_TypedArray") const std::vector< CTYPE > &TYPEDARRAY ($*1_ltype temp) {
+  if (!$input->Is##ARRAY()) {
+    SWIG_exception_fail(SWIG_TypeError, "in method '" "$symname" "', argument " "$argnum" " is not a " #ARRAY);
+  }
+  size_t length;
+  CTYPE *data = (CTYPE *)SWIGV8_TypedArrayData($input, &length);
+  temp.assign(data, data + length);
+  $1 = &temp;
+}
+%typemap(out, fragment="SWIGV8_VectorArrayBuffer") std::vector< CTYPE > TYPEDARRAY {
+  std::vector< CTYPE > &vec = $1;
+  size_t length = vec.size();
+  $result = v8::ARRAY::New(SWIGV8_VectorArrayBuffer(vec), 0, length);
+}
+%typemap(out, fragment="SWIGV8_TypedArray") const std::vector< CTYPE > &TYPEDARRAY {
+  $result = v8::ARRAY::New(SWIGV8_NewArrayBuffer($1->empty() ? 0 : &(*$1)[0], $1->size() * sizeof(CTYPE)), 0, $1->size());
+}
+%enddef
+
+SWIG_STD_VECTOR_TYPEDARRAY(signed char, Int8Array)
+SWIG_STD_VECTOR_TYPEDARRAY(unsigned char, Uint8Array)
+SWIG_STD_VECTOR_TYPEDARRAY(short, Int16Array)
+SWIG_STD_VECTOR_TYPEDARRAY(unsigned short, Uint16Array)
+SWIG_STD_VECTOR_TYPEDARRAY(int, Int32Array)
+SWIG_STD_VECTOR_TYPEDARRAY(unsigned int, Uint32Array)
+SWIG_STD_VECTOR_TYPEDARRAY(float, Float32Array)
+SWIG_STD_VECTOR_TYPEDARRAY(double, Float64Array)
+
 %define specialize_std_vector(T)
 #warning "specialize_std_vector - specialization for type T no longer needed"
 %enddef
@@ -0,0 +1,35 @@
+/* -----------------------------------------------------------------------------
+ * lua_borrowed.i
+ *
+ * Reuse of the Lua objects for pointers which Lua does not own.
+ * ----------------------------------------------------------------------------- */
+
+/*
+Every pointer or reference returned to Lua is wrapped in a new userdata, even if
+Lua does not own the object it points to and the same pointer was returned before.
+Code that fetches many such borrowed pointers, for example every frame, creates
+a lot of garbage. The %lua_borrowed macro changes the out typemaps for pointers
+and references to the given type so that a pointer which Lua does not own is
+wrapped in the same userdata as long as that userdata is still alive:
+
+  %include <lua_borrowed.i>
+  %lua_borrowed(Entity)
+  Entity *World::entity(int id);
+
+  local e1 = world:entity(1)
+  local e2 = world:entity(1)   -- no allocation, rawequal(e1,e2) is true
+
+Pointers returned with ownership, such as from %newobject functions, are wrapped
+in a new userdata as usual.
+*/
+
+%define %lua_borrowed(TYPE...)
+%typemap(out) TYPE *, TYPE &, const TYPE *, const TYPE &
+%{if ($owner) SWIG_NewPointerObj(L,$1,$descriptor,$owner);
+  else SWIG_Lua_NewBorrowedPointerObj(L,(void *)$1,$descriptor);
+  SWIG_arg++; %}
+%typemap(out) TYPE *const&, const TYPE *const&
+%{if ($owner) SWIG_NewPointerObj(L,*$1,$*descriptor,$owner);
+  else SWIG_Lua_NewBorrowedPointerObj(L,(void *)*$1,$*descriptor);
+  SWIG_arg++; %}
+%enddef
@@ -152,12 +152,43 @@
   %swig_sequence_iterator(Map);
   %swig_container_methods(Map)
 
+#if defined(SWIG_PYTHON_CHUNKED_ITERATORS)
+  %extend {
+    PyObject *key_chunk_iterator(PyObject **PYTHON_SELF) {
+      return swig::make_output_chunk_iterator(swig::make_output_key_iterator(self->begin(), self->begin(), self->end(), *PYTHON_SELF));
+    }
+
+    PyObject *value_chunk_iterator(PyObject **PYTHON_SELF) {
+      return swig::make_output_chunk_iterator(swig::make_output_value_iterator(self->begin(), self->begin(), self->end(), *PYTHON_SELF));
+    }
+  }
+#endif
+
 #if defined(SWIGPYTHON_BUILTIN)
   %feature("python:slot", "mp_length", functype="lenfunc") __len__;
   %feature("python:slot", "mp_subscript", functype="binaryfunc") __getitem__;
+#if defined(SWIG_PYTHON_CHUNKED_ITERATORS)
+  %feature("python:slot", "tp_iter", functype="getiterfunc") key_chunk_iterator;
+#else
   %feature("python:slot", "tp_iter", functype="getiterfunc") key_iterator;
+#endif
   %feature("python:slot", "sq_contains", functype="objobjproc") __contains__;
 
+#if defined(SWIG_PYTHON_CHUNKED_ITERATORS)
+  %extend {
+    PyObject *iterkeys(PyObject **PYTHON_SELF) {
+      return swig::make_output_chunk_iterator(swig::make_output_key_iterator(self->begin(), self->begin(), self->end(), *PYTHON_SELF));
+    }
+
+    PyObject *itervalues(PyObject **PYTHON_SELF) {
+      return swig::make_output_chunk_iterator(swig::make_output_value_iterator(self->begin(), self->begin(), self->end(), *PYTHON_SELF));
+    }
+
+    PyObject *iteritems(PyObject **PYTHON_SELF) {
+      return swig::make_output_chunk_iterator(swig::make_output_iterator(self->begin(), self->begin(), self->end(), *PYTHON_SELF));
+    }
+  }
+#else
   %extend {
     %newobject iterkeys(PyObject **PYTHON_SELF);
     swig::SwigPyIterator* iterkeys(PyObject **PYTHON_SELF) {
@@ -174,7 +205,19 @@
       return swig::make_output_iterator(self->begin(), self->begin(), self->end(), *PYTHON_SELF);
     }
   }
+#endif
 
+#elif defined(SWIG_PYTHON_CHUNKED_ITERATORS)
+  %extend {
+    %pythoncode %{def __iter__(self):
+    return self.key_chunk_iterator()%}
+    %pythoncode %{def iterkeys(self):
+    return self.key_chunk_iterator()%}
+    %pythoncode %{def itervalues(self):
+    return self.value_chunk_iterator()%}
+    %pythoncode %{def iteritems(self):
+    return self.chunk_iterator()%}
+  }
 #else
   %extend {
     %pythoncode %{def __iter__(self):
@@ -247,6 +247,7 @@
 /* please leave 720-739 free for Scilab */
 
 #define WARN_PYTHON_INDENT_MISMATCH           740
+#define WARN_PYTHON_ASYNC_INLINE              741
 
 /* please leave 740-759 free for Python */
 
@@ -267,6 +268,7 @@
 
 #define WARN_RUBY_WRONG_NAME                  801
 #define WARN_RUBY_MULTIPLE_INHERITANCE        802
+#define WARN_RUBY_NOGVL_UNSUPPORTED           803
 
 /* please leave 800-809 free for Ruby */
 
@@ -331,6 +333,7 @@
 /* please leave 870-889 free for PHP */
 
 #define WARN_GO_NAME_CONFLICT                 890
+#define WARN_GO_BATCH_UNSUPPORTED             891
 
 /* please leave 890-899 free for Go */
 
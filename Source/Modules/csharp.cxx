@@ -815,6 +815,7 @@ public:
       if (imtypeout)
 	tm = imtypeout;
       Printf(im_return_type, "%s", tm);
+      substituteClassname(t, im_return_type);
       im_outattributes = Getattr(n, "tmap:imtype:outattributes");
     } else {
       Swig_warning(WARN_CSHARP_TYPEMAP_CSTYPE_UNDEF, input_file, line_number, "No imtype typemap defined for %s\n", SwigType_str(t, 0));
@@ -884,6 +885,7 @@ public:
       if ((tm = Getattr(p, "tmap:imtype"))) {
 	const String *inattributes = Getattr(p, "tmap:imtype:inattributes");
 	Printf(im_param_type, "%s%s", inattributes ? inattributes : empty_string, tm);
+	substituteClassname(pt, im_param_type);
       } else {
 	Swig_warning(WARN_CSHARP_TYPEMAP_CSTYPE_UNDEF, input_file, line_number, "No imtype typemap defined for %s\n", SwigType_str(pt, 0));
       }
@@ -2062,6 +2064,100 @@ public:
     }
   }
 
+  /* ----------------------------------------------------------------------
+   * blittableClass()
+   *
+   * Returns true if the proxy for the class being wrapped is a blittable C#
+   * struct, as requested with %feature("csblittable").
+   * ---------------------------------------------------------------------- */
+
+  bool blittableClass() {
+    Node *cls = getCurrentClass();
+    return proxy_flag && cls && GetFlag(cls, "feature:csblittable");
+  }
+
+  /* ----------------------------------------------------------------------
+   * blittableType()
+   *
+   * Returns true if the C# type of a member variable of this type in a blittable
+   * struct has the same representation as the C++ type.
+   * ---------------------------------------------------------------------- */
+
+  bool blittableType(SwigType *t) {
+    SwigType *resolved = SwigType_typedef_resolve_all(t);
+    SwigType *type = SwigType_strip_qualifiers(resolved);
+    bool blittable = false;
+    switch (SwigType_type(type)) {
+    case T_SCHAR:
+    case T_UCHAR:
+    case T_SHORT:
+    case T_USHORT:
+    case T_INT:
+    case T_UINT:
+    case T_LONGLONG:
+    case T_ULONGLONG:
+    case T_FLOAT:
+    case T_DOUBLE:
+      blittable = true;
+      break;
+    case T_USER:
+      {
+	Node *cls = classLookup(type);
+	blittable = cls && GetFlag(cls, "feature:csblittable");
+      }
+      break;
+    default:
+      break;
+    }
+    Delete(type);
+    Delete(resolved);
+    return blittable;
+  }
+
+  /* ----------------------------------------------------------------------
+   * checkBlittableClass()
+   *
+   * Check that the layout of the C# struct generated for a class marked with
+   * %feature("csblittable") can match the C++ class.
+   * ---------------------------------------------------------------------- */
+
+  void checkBlittableClass(Node *n) {
+    SwigType *typemap_lookup_type = Getattr(n, "classtypeobj");
+    String *classname = SwigType_namestr(Getattr(n, "name"));
+    if (!Strstr(typemapLookup(n, "csclassmodifiers", typemap_lookup_type, WARN_NONE), "struct"))
+      Swig_error(Getfile(n), Getline(n), "The csblittable feature for %s requires the typemaps in the %%csblittable macro in csblittable.i.\n", classname);
+    if (Getattr(n, "bases"))
+      Swig_error(Getfile(n), Getline(n), "Blittable struct %s cannot have base classes.\n", classname);
+    for (Node *c = firstChild(n); c; c = nextSibling(c)) {
+      if (checkAttribute(c, "storage", "virtual")) {
+	Swig_error(Getfile(c), Getline(c), "Blittable struct %s cannot have virtual methods.\n", classname);
+	break;
+      }
+      // A user-provided copy constructor or destructor makes the class not trivially copyable, defaulted or deleted ones do not.
+      // The implicit destructor and copy constructor added by Language::classDeclaration() are skipped using the allocate flags.
+      if (!checkAttribute(c, "value", "default") && !checkAttribute(c, "value", "delete")) {
+	if (Equal(nodeType(c), "destructor") && Getattr(n, "allocate:has_destructor")) {
+	  Swig_error(Getfile(c), Getline(c), "Blittable struct %s cannot have a user-declared destructor.\n", classname);
+	  continue;
+	}
+	if (Equal(nodeType(c), "constructor") && GetFlag(c, "copy_constructor") && Getattr(n, "allocate:has_copy_constructor")) {
+	  Swig_error(Getfile(c), Getline(c), "Blittable struct %s cannot have a user-declared copy constructor.\n", classname);
+	  continue;
+	}
+      }
+      if (!Equal(nodeType(c), "cdecl") || !checkAttribute(c, "kind", "variable") || checkAttribute(c, "storage", "static") || Getattr(c, "feature:extend"))
+	continue;
+      String *name = Getattr(c, "name");
+      if (!checkAttribute(c, "access", "public"))
+	Swig_error(Getfile(c), Getline(c), "Member variable %s in blittable struct %s must be public.\n", name, classname);
+      else if (Getattr(c, "bitfield"))
+	Swig_error(Getfile(c), Getline(c), "Member variable %s in blittable struct %s cannot be a bit field.\n", name, classname);
+      else if (!blittableType(Getattr(c, "type")))
+	Swig_error(Getfile(c), Getline(c), "Member variable %s in blittable struct %s has type %s which is not blittable.\n", name, classname, SwigType_str(Getattr(c, "type"), 0));
+    }
+    Delete(classname);
+  }
+
   /* ----------------------------------------------------------------------
    * classHandler()
    * ---------------------------------------------------------------------- */
@@ -2149,6 +2245,9 @@ public:
       }
     }
 
+    if (proxy_flag && GetFlag(n, "feature:csblittable"))
+      checkBlittableClass(n);
+
     Language::classHandler(n);
 
     if (proxy_flag) {
@@ -2401,7 +2500,7 @@ public:
 
     Printv(imcall, full_imclass_name, ".$imfuncname(", NIL);
     if (!static_flag)
-      Printf(imcall, "swigCPtr");
+      Printf(imcall, blittableClass() ? "ref this" : "swigCPtr");
 
     emit_mark_varargs(l);
 
@@ -2637,6 +2736,27 @@ public:
     Delete(imcall);
   }
 
+  /* ----------------------------------------------------------------------
+   * constructorDeclaration()
+   * ---------------------------------------------------------------------- */
+
+  virtual int constructorDeclaration(Node *n) {
+    // A blittable struct is created in C# without a C++ object
+    if (blittableClass())
+      return SWIG_NOWRAP;
+    return Language::constructorDeclaration(n);
+  }
+
+  /* ----------------------------------------------------------------------
+   * destructorDeclaration()
+   * ---------------------------------------------------------------------- */
+
+  virtual int destructorDeclaration(Node *n) {
+    if (blittableClass())
+      return SWIG_NOWRAP;
+    return Language::destructorDeclaration(n);
+  }
+
   /* ----------------------------------------------------------------------
    * constructorHandler()
    * ---------------------------------------------------------------------- */
@@ -2881,6 +3001,22 @@ public:
 
   virtual int membervariableHandler(Node *n) {
 
+    if (blittableClass() && !Getattr(n, "feature:extend")) {
+      // Member variables of a blittable struct are fields, laid out as in the C++ class
+      String *tm = Swig_typemap_lookup("cstype", n, "", 0);
+      if (tm) {
+	substituteClassname(Getattr(n, "type"), tm);
+	const String *csattributes = Getattr(n, "feature:cs:attributes");
+	if (csattributes)
+	  Printf(proxy_class_code, "  %s\n", csattributes);
+	const String *methodmods = Getattr(n, "feature:cs:methodmodifiers");
+	Printf(proxy_class_code, "  %s %s %s;\n", methodmods ? methodmods : public_string, tm, Getattr(n, "sym:name"));
+      } else {
+	Swig_warning(WARN_CSHARP_TYPEMAP_CSTYPE_UNDEF, input_file, line_number, "No cstype typemap defined for %s\n", SwigType_str(Getattr(n, "type"), 0));
+      }
+      return SWIG_OK;
+    }
+
     generate_property_declaration_flag = true;
     variable_name = Getattr(n, "sym:name");
     wrapping_member_flag = true;
@@ -3142,9 +3278,11 @@ public:
 	  p = last_parm;	// (last parameter is the only parameter for properties)
 	  SwigType *pt = Getattr(p, "type");
 	  if ((tm = Getattr(p, "tmap:cstype"))) {
-	    substituteClassname(pt, tm);
             String *cstypeout = Getattr(p, "tmap:cstype:out");	// the type in the cstype typemap's out attribute overrides the type in the typemap
-	    variable_type = cstypeout ? cstypeout : tm;
+	    if (cstypeout)
+	      tm = cstypeout;
+	    substituteClassname(pt, tm);
+	    variable_type = tm;
 	  } else {
 	    Swig_warning(WARN_CSHARP_TYPEMAP_CSOUT_UNDEF, input_file, line_number, "No csvarin typemap defined for %s\n", SwigType_str(pt, 0));
 	  }
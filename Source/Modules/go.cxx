@@ -1014,6 +1014,12 @@ private:
 	ret = r;
       }
     } else {
+      if (GetFlag(n, "feature:go:batch") && !base) {
+	Swig_warning(WARN_GO_BATCH_UNSUPPORTED, input_file, line_number,
+		     "Ignoring go:batch feature for '%s', batch wrappers are not supported for %s.\n",
+		     Getattr(n, "sym:name"), "wrappers generated without -cgo");
+      }
+
       int r = goFunctionWrapper(n, name, go_name, overname, wname, base, parms, result, is_static);
       if (r != SWIG_OK) {
 	ret = r;
@@ -1126,6 +1132,13 @@ private:
       ret = r;
     }
 
+    if (GetFlag(n, "feature:go:batch") && !base && checkBatchable(&info)) {
+      r = cgoBatchWrappers(&info);
+      if (r != SWIG_OK) {
+	ret = r;
+      }
+    }
+
     Swig_restore(n);
 
     return ret;
@@ -1599,6 +1612,328 @@ private:
     return SWIG_OK;
   }
 
+  /* ----------------------------------------------------------------------
+   * isBatchGoType()
+   *
+   * Whether a value of this type can be passed in a slice to a batch
+   * wrapper: a Go number or bool with no goin or goout conversion.
+   * ---------------------------------------------------------------------- */
+
+  bool isBatchGoType(Node *n, SwigType *type, const char *conversion) {
+    if (goGetattr(n, conversion) || goTypeIsInterface(n, type)) {
+      return false;
+    }
+    String *gt = goType(n, type);
+    static const char *batch_types[] = {
+      "bool", "byte", "int8", "uint8", "int16", "uint16", "int32", "uint32",
+      "int64", "uint64", "int", "uint", "float32", "float64", NULL
+    };
+    bool ret = false;
+    for (int i = 0; batch_types[i]; ++i) {
+      if (Strcmp(gt, batch_types[i]) == 0) {
+	ret = true;
+	break;
+      }
+    }
+    Delete(gt);
+    return ret;
+  }
+
+  /* ----------------------------------------------------------------------
+   * checkBatchable()
+   *
+   * Check that a batch wrapper can be generated for a function with
+   * the go:batch feature, giving a warning if not.
+   * ---------------------------------------------------------------------- */
+
+  bool checkBatchable(const cgoWrapperInfo *info) {
+    const char *reason = NULL;
+    Wrapper *dummy = initGoTypemaps(info->parms);
+
+    if (info->is_constructor || info->is_destructor) {
+      reason = "constructors and destructors";
+    } else if (info->overname) {
+      reason = "overloaded functions";
+    } else if (emit_num_arguments(info->parms) != emit_num_required(info->parms)) {
+      reason = "functions with default arguments";
+    } else {
+      bool has_slice = false;
+      int parm_count = emit_num_arguments(info->parms);
+      Parm *p = info->parms;
+      for (int i = 0; i < parm_count && !reason; ++i) {
+	p = getParm(p);
+	if (i > 0 || !info->receiver) {
+	  if (!isBatchGoType(p, Getattr(p, "type"), "tmap:goin") || Getattr(p, "tmap:argout")) {
+	    reason = "parameter types other than Go numbers and bool";
+	  }
+	  has_slice = true;
+	}
+	p = nextParm(p);
+      }
+      if (!reason && SwigType_type(info->result) != T_VOID) {
+	Swig_save("checkBatchable", info->n, "type", "tmap:goout", NULL);
+	Setattr(info->n, "type", info->result);
+	String *goout = goTypemapLookup("goout", info->n, "swig_r");
+	if (goout || !isBatchGoType(info->n, info->result, "tmap:goout")) {
+	  reason = "result types other than Go numbers and bool";
+	}
+	Swig_restore(info->n);
+	has_slice = true;
+      }
+      if (!reason && !has_slice) {
+	reason = "functions without parameters or a result";
+      }
+    }
+
+    DelWrapper(dummy);
+
+    if (reason) {
+      Swig_warning(WARN_GO_BATCH_UNSUPPORTED, input_file, line_number,
+		   "Ignoring go:batch feature for '%s', batch wrappers are not supported for %s.\n",
+		   Getattr(info->n, "sym:name"), reason);
+      return false;
+    }
+    return true;
+  }
+
+  /* ----------------------------------------------------------------------
+   * cgoBatchWrappers()
+   *
+   * Write out the batch wrappers for a function with the go:batch
+   * feature.  The Go function has the name of the function with a
+   * Batch suffix and takes a slice for each parameter other than the
+   * receiver, preceded by a slice for the results if the function
+   * returns a value.  The C/C++ function calls the wrapped function
+   * once for each element of the slices, so that all the calls cost a
+   * single cgo call.
+   * ---------------------------------------------------------------------- */
+
+  int cgoBatchWrappers(const cgoWrapperInfo *info) {
+    Node *n = info->n;
+    bool has_result = SwigType_type(info->result) != T_VOID;
+
+    String *go_name = NewStringf("%sBatch", info->go_name);
+    String *scope = NULL;
+    if (info->receiver) {
+      scope = NewStringf("swiggoscope.%s", class_name);
+    }
+    if (!checkNameConflict(go_name, n, scope)) {
+      Delete(scope);
+      Delete(go_name);
+      return SWIG_NOWRAP;
+    }
+    Delete(scope);
+
+    String *wname = NewStringf("%s_batch", info->wname);
+
+    Wrapper *dummy = initGoTypemaps(info->parms);
+
+    int parm_count = emit_num_arguments(info->parms);
+
+    // The Go function.
+
+    String *parm_print = NewString("(");
+    String *first_slice = NULL;
+    if (has_result) {
+      String *tm = goType(n, info->result);
+      Printv(parm_print, "_swig_result []", tm, NULL);
+      Delete(tm);
+      first_slice = NewString("_swig_result");
+    }
+
+    Parm *p = info->parms;
+    for (int i = 0; i < parm_count; ++i) {
+      p = getParm(p);
+      if (i > 0 || !info->receiver) {
+	if (Len(parm_print) > 1) {
+	  Printv(parm_print, ", ", NULL);
+	}
+	String *tm = goType(p, Getattr(p, "type"));
+	Printv(parm_print, Getattr(p, "lname"), " []", tm, NULL);
+	Delete(tm);
+	if (!first_slice) {
+	  first_slice = Copy(Getattr(p, "lname"));
+	}
+      }
+      p = nextParm(p);
+    }
+    Printv(parm_print, ")", NULL);
+
+    Printv(f_go_wrappers, "func ", NULL);
+    if (info->receiver) {
+      Printv(f_go_wrappers, "(", Getattr(info->parms, "lname"), " ", info->receiver, ") ", NULL);
+    }
+    Printv(f_go_wrappers, go_name, parm_print, " {\n", NULL);
+
+    if (interfaces && info->receiver && checkFunctionVisibility(n, NULL)) {
+      Printv(interfaces, "\t", go_name, parm_print, "\n", NULL);
+    }
+
+    Printv(f_go_wrappers, "\t_swig_n := len(", first_slice, ")\n", NULL);
+    p = info->parms;
+    for (int i = 0; i < parm_count; ++i) {
+      p = getParm(p);
+      String *ln = Getattr(p, "lname");
+      if ((i > 0 || !info->receiver) && Cmp(ln, first_slice) != 0) {
+	Printv(f_go_wrappers, "\tif len(", ln, ") != _swig_n {\n", NULL);
+	Printv(f_go_wrappers, "\t\tpanic(\"", go_name, ": slices have different lengths\")\n", NULL);
+	Printv(f_go_wrappers, "\t}\n", NULL);
+      }
+      p = nextParm(p);
+    }
+    Printv(f_go_wrappers, "\tif _swig_n == 0 {\n\t\treturn\n\t}\n", NULL);
+
+    Printv(f_go_wrappers, "\tC.", wname, "(C.swig_intgo(_swig_n)", NULL);
+    if (has_result) {
+      Printv(f_go_wrappers, ", *(*C._goslice_)(unsafe.Pointer(&_swig_result))", NULL);
+    }
+    p = info->parms;
+    for (int i = 0; i < parm_count; ++i) {
+      p = getParm(p);
+      String *ln = Getattr(p, "lname");
+      if (i == 0 && info->receiver) {
+	bool c_struct_type;
+	String *ct = cgoTypeForGoValue(p, Getattr(p, "type"), &c_struct_type);
+	Printv(f_go_wrappers, ", C.", ct, "(", ln, ")", NULL);
+	Delete(ct);
+      } else {
+	Printv(f_go_wrappers, ", *(*C._goslice_)(unsafe.Pointer(&", ln, "))", NULL);
+      }
+      p = nextParm(p);
+    }
+    Printv(f_go_wrappers, ")\n", NULL);
+
+    // Keep the slices live across the C/C++ call, as in goargout.
+    Printv(f_go_wrappers, "\tif Swig_escape_always_false {\n", NULL);
+    if (has_result) {
+      Printv(f_go_wrappers, "\t\tSwig_escape_val = _swig_result\n", NULL);
+    }
+    p = info->parms;
+    for (int i = 0; i < parm_count; ++i) {
+      p = getParm(p);
+      if (i > 0 || !info->receiver) {
+	Printv(f_go_wrappers, "\t\tSwig_escape_val = ", Getattr(p, "lname"), "\n", NULL);
+      }
+      p = nextParm(p);
+    }
+    Printv(f_go_wrappers, "\t}\n", NULL);
+    Printv(f_go_wrappers, "}\n\n", NULL);
+
+    // The declaration in the cgo comment.
+
+    Printv(f_cgo_comment, "extern void ", wname, "(intgo _swig_n", NULL);
+    if (has_result) {
+      Printv(f_cgo_comment, ", _goslice_ _swig_result", NULL);
+    }
+    p = info->parms;
+    for (int i = 0; i < parm_count; ++i) {
+      p = getParm(p);
+      String *ln = Getattr(p, "lname");
+      if (i == 0 && info->receiver) {
+	bool c_struct_type;
+	String *ct = cgoTypeForGoValue(p, Getattr(p, "type"), &c_struct_type);
+	Printv(f_cgo_comment, ", ", ct, " ", ln, NULL);
+	Delete(ct);
+      } else {
+	Printv(f_cgo_comment, ", _goslice_ ", ln, NULL);
+      }
+      p = nextParm(p);
+    }
+    Printv(f_cgo_comment, ");\n", NULL);
+
+    DelWrapper(dummy);
+
+    // The C/C++ function, which applies the usual typemaps to each
+    // element of the slices in turn.
+
+    Wrapper *f = NewWrapper();
+    String *empty = NewString("");
+
+    Swig_save("cgoBatchWrappers", n, "parms", NULL);
+
+    ParmList *parms = info->parms;
+    emit_parameter_variables(parms, f);
+    emit_attach_parmmaps(parms, f);
+    emit_return_variable(n, info->result, f);
+
+    Printv(f->def, "void ", wname, "(intgo _swig_go_n", NULL);
+    if (has_result) {
+      Printv(f->def, ", _goslice_ _swig_go_results", NULL);
+      String *ln = NewString("_swig_go_result");
+      String *ct = gcCTypeForGoValue(n, info->result, ln);
+      Wrapper_add_local(f, "_swig_go_result", ct);
+      Delete(ct);
+      Delete(ln);
+    }
+    Wrapper_add_local(f, "_swig_go_i", "intgo _swig_go_i");
+
+    p = parms;
+    for (int i = 0; i < parm_count; ++i) {
+      p = getParm(p);
+      String *pn = NewStringf("_swig_go_%d", i);
+      String *input;
+      if (i == 0 && info->receiver) {
+	String *ct = gcCTypeForGoValue(p, Getattr(p, "type"), pn);
+	Printv(f->def, ", ", ct, NULL);
+	Delete(ct);
+	input = Copy(pn);
+      } else {
+	Printv(f->def, ", _goslice_ ", pn, NULL);
+	String *ct = gcCTypeForGoValue(p, Getattr(p, "type"), empty);
+	input = NewStringf("((%s*)%s.array)[_swig_go_i]", ct, pn);
+	Delete(ct);
+      }
+      Setattr(p, "emit:input", input);
+      Delete(input);
+      Delete(pn);
+      p = nextParm(p);
+    }
+    Printv(f->def, ") {\n", NULL);
+
+    Printv(f->code, "\tfor (_swig_go_i = 0; _swig_go_i < _swig_go_n; ++_swig_go_i) {\n", NULL);
+
+    p = parms;
+    for (int i = 0; i < parm_count; ++i) {
+      p = getParm(p);
+      String *tm = Getattr(p, "tmap:in");
+      if (tm) {
+	tm = Copy(tm);
+	Replaceall(tm, "$input", Getattr(p, "emit:input"));
+	Printv(f->code, "\t", tm, "\n", NULL);
+	Delete(tm);
+      }
+      p = nextParm(p);
+    }
+
+    checkConstraints(parms, f);
+
+    emitGoAction(n, NULL, parms, info->result, f);
+
+    cleanupFunction(n, f, parms);
+
+    if (has_result) {
+      String *ct = gcCTypeForGoValue(n, info->result, empty);
+      Printf(f->code, "\t((%s*)_swig_go_results.array)[_swig_go_i] = _swig_go_result;\n", ct);
+      Delete(ct);
+    }
+
+    Printv(f->code, "\t}\n", NULL);
+    Printv(f->code, "}\n", NULL);
+
+    Wrapper_print(f, f_c_wrappers);
+
+    Swig_restore(n);
+
+    DelWrapper(f);
+    Delete(empty);
+    Delete(first_slice);
+    Delete(parm_print);
+    Delete(wname);
+    Delete(go_name);
+
+    return SWIG_OK;
+  }
+
   /* ----------------------------------------------------------------------
    * goFunctionWrapper()
    *
@@ -2056,16 +2056,20 @@ public:
     }
     // Emit the finalize and delete methods
     if (tm) {
+      String *destruct_jnicall = *Char(destructor_call) ? Copy(destructor_call) : NewString("throw new UnsupportedOperationException(\"C++ destructor does not have public access\")");
       // Finalize method
       if (*Char(destructor_call)) {
 	Printv(proxy_class_def, typemapLookup(n, "javafinalize", typemap_lookup_type, WARN_NONE), NIL);
       }
+      // Cleanup code run instead of a finalizer, emitted even without a public destructor as the javabody typemaps may refer to it
+      String *cleanup = Copy(typemapLookup(n, "javacleanup", typemap_lookup_type, WARN_NONE));
+      Replaceall(cleanup, "$jnicall", destruct_jnicall);
+      Printv(proxy_class_def, cleanup, NIL);
+      Delete(cleanup);
       // delete method
       Printv(destruct, tm, NIL);
-      if (*Char(destructor_call))
-	Replaceall(destruct, "$jnicall", destructor_call);
-      else
-	Replaceall(destruct, "$jnicall", "throw new UnsupportedOperationException(\"C++ destructor does not have public access\")");
+      Replaceall(destruct, "$jnicall", destruct_jnicall);
+      Delete(destruct_jnicall);
       if (*Char(destruct)) {
 	Printv(proxy_class_def, "\n  ", NIL);
 	const String *methodmods = Getattr(n, "destructmethodmodifiers");
@@ -100,6 +100,10 @@ Lua Options (available with -lua)\n\
      -squash-bases   - Squashes symbols from all inheritance tree of a given class\n\
                        into itself. Emulates pre-SWIG3.0 inheritance. Insignificantly\n\
                        speeds things up, but increases memory consumption.\n\
+     -flatten-members\n\
+                     - Build a table of all the members of each class, including\n\
+                       inherited ones, when the class is registered, so that member\n\
+                       access is a single table lookup.\n\
 \n";
 
 static int nomoduleglobal = 0;
@@ -107,6 +111,7 @@ static int elua_ltr = 0;
 static int eluac_ltr = 0;
 static int elua_emulate = 0;
 static int squash_bases = 0;
+static int flatten_members = 0;
 /* The new metatable bindings were introduced in SWIG 3.0.0.
  * old_metatable_bindings in v2: 
  *                    1. static methods will be put into the scope their respective class
@@ -241,6 +246,9 @@ public:
 	} else if (strcmp(argv[i], "-squash-bases") == 0) {
 	  Swig_mark_arg(i);
 	  squash_bases = 1;
+	} else if (strcmp(argv[i], "-flatten-members") == 0) {
+	  Swig_mark_arg(i);
+	  flatten_members = 1;
 	} else if (strcmp(argv[i], "-elua-emulate") == 0) {
 	  Swig_mark_arg(i);
 	  elua_emulate = 1;
@@ -340,6 +348,8 @@ public:
     }
     if (squash_bases)
       Printf(f_runtime, "#define SWIG_LUA_SQUASH_BASES\n");
+    if (flatten_members)
+      Printf(f_runtime, "#define SWIG_LUA_FLATTEN_MEMBERS\n");
 
     //    if (NoInclude) {
     //      Printf(f_runtime, "#define SWIG_NOINCLUDE\n");
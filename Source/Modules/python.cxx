@@ -28,6 +28,10 @@
 #define PYTHON_INT_MIN (-2147483647-1)
 
 static String *const_code = 0;
+static String *lazy_constants = 0;
+static String *lazy_constant_names = 0;
+static int lazy_constant_count = 0;
+static List *lazy_shadow_names = 0;
 static String *module = 0;
 static String *package = 0;
 static String *mainmodule = 0;
@@ -36,6 +40,7 @@ static String *global_name = 0;
 static int shadow = 1;
 static int use_kw = 0;
 static int director_method_index = 0;
+static List *director_method_names = 0;
 static int builtin = 0;
 
 static File *f_begin = 0;
@@ -91,6 +96,8 @@ static int castmode = 0;
 static int extranative = 0;
 static int nortti = 0;
 static int relativeimport = 0;
+static int deferinit = 0;
+static int async_used = 0;
 
 /* flags for the make_autodoc function */
 enum autodoc_t {
@@ -110,6 +117,7 @@ Python Options (available with -python)\n\
      -castmode       - Enable the casting mode, which allows implicit cast between types in Python\n\
      -debug-doxygen-parser     - Display doxygen parser module debugging information\n\
      -debug-doxygen-translator - Display doxygen translator module debugging information\n\
+     -deferinit      - Defer creating functions and constants until first access (Python 3.7+)\n\
      -dirvtable      - Generate a pseudo virtual table for directors for faster dispatch\n\
      -doxygen        - Convert C++ doxygen comments to pydoc comments in proxy classes\n\
      -extranative    - Return extra native wrappers for C++ std containers wherever possible\n\
@@ -232,6 +240,273 @@ public:
     return threads && !GetFlagAttr(n, "feature:nothread");
   }
 
+  /* ------------------------------------------------------------
+   * Asynchronous functions, %feature("async")
+   * Not supported for the builtin slots, these are called by the
+   * interpreter which expects the result rather than a future.
+   * ------------------------------------------------------------ */
+  int async_enable(Node *n) const {
+    return GetFlag(n, "feature:async") && !(builtin && (Getattr(n, "feature:python:slot") || Getattr(n, "feature:python:compare")));
+  }
+
+  void emitAsyncWrapper(String *wname, String *sync_name, int kw) {
+    if (kw) {
+      Printv(f_wrappers, "SWIGINTERN PyObject *", wname, "(PyObject *self, PyObject *args, PyObject *kwargs) {\n", NIL);
+      Printv(f_wrappers, "  return SWIG_Python_AsyncCall(self, args, kwargs, 0, ", sync_name, ");\n", NIL);
+    } else {
+      Printv(f_wrappers, "SWIGINTERN PyObject *", wname, "(PyObject *self, PyObject *args) {\n", NIL);
+      Printv(f_wrappers, "  return SWIG_Python_AsyncCall(self, args, NULL, ", sync_name, ", 0);\n", NIL);
+    }
+    Printv(f_wrappers, "}\n\n", NIL);
+    async_used = 1;
+  }
+
+  /* ------------------------------------------------------------
+   * asyncFrameReplace()
+   *
+   * Returns a copy of code with the identifiers in names, other than
+   * members and qualified names, replaced by their swigf frame member.
+   * Comments and string and character literals are left as they are.
+   * ------------------------------------------------------------ */
+
+  String *asyncFrameReplace(String *code, Hash *names) {
+    String *result = NewString("");
+    const char *c = Char(code);
+    char prev = 0;
+    char prev2 = 0;
+    while (*c) {
+      if (c[0] == '/' && c[1] == '*') {
+	const char *end = strstr(c + 2, "*/");
+	end = end ? end + 2 : c + strlen(c);
+	Write(result, c, (int)(end - c));
+	c = end;
+      } else if (c[0] == '/' && c[1] == '/') {
+	const char *end = strchr(c, '\n');
+	end = end ? end : c + strlen(c);
+	Write(result, c, (int)(end - c));
+	c = end;
+      } else if (*c == '"' || *c == '\'') {
+	const char *end = c + 1;
+	while (*end && *end != *c) {
+	  if (*end == '\\' && end[1])
+	    end++;
+	  end++;
+	}
+	if (*end)
+	  end++;
+	Write(result, c, (int)(end - c));
+	c = end;
+	prev2 = prev;
+	prev = '"';
+      } else if (isalpha((int)*c) || *c == '_' || *c == '$' || isdigit((int)*c)) {
+	const char *end = c;
+	while (isalnum((int)*end) || *end == '_' || *end == '$')
+	  end++;
+	String *id = NewStringWithSize(c, (int)(end - c));
+	bool member = prev == '.' || (prev == '>' && prev2 == '-') || (prev == ':' && prev2 == ':');
+	if (!member && Getattr(names, id))
+	  Append(result, "swigf->");
+	Append(result, id);
+	Delete(id);
+	c = end;
+	prev2 = prev;
+	prev = 'a';
+      } else {
+	Putc(*c, result);
+	if (!isspace((int)*c)) {
+	  prev2 = prev;
+	  prev = *c;
+	} else {
+	  prev2 = prev = ' ';
+	}
+	c++;
+      }
+    }
+    return result;
+  }
+
+  /* ------------------------------------------------------------
+   * asyncFrameWrapper()
+   *
+   * Splits the wrapper f of an asynchronous function at the
+   * SWIG_PYTHON_ASYNC_SPLIT marker placed before the C/C++ call, see
+   * pyasync.swg. The local variables move into a heap allocated frame,
+   * so that the caller converts the arguments and a worker thread makes
+   * the call with the same frame, calling the wrapper wdefname again with
+   * call_args. objs is the size of the swig_obj parameter of an overload,
+   * which points into the stack of the caller and is copied into the
+   * frame. Returns false, leaving f unchanged, if a local variable can't
+   * be moved into the frame, such as a reference.
+   * ------------------------------------------------------------ */
+
+  bool asyncFrameWrapper(Wrapper *f, String *wname, String *wdefname, const char *call_args, int objs) {
+    const char *marker = "SWIG_PYTHON_ASYNC_SPLIT\n";
+    char *split = Strstr(f->code, marker);
+    if (!split)
+      return false;
+
+    String *frame = NewStringf("%s_async_frame", wname);
+    String *members = NewString("");
+    String *inits = NewString("");
+    String *locals = NewString("");
+    Hash *names = NewHash();
+    bool ok = true;
+
+    // Each local variable declaration is on its own line
+    List *lines = SplitLines(f->locals);
+    for (Iterator it = First(lines); it.item && ok; it = Next(it)) {
+      const char *c = Char(it.item);
+      while (isspace((int)*c))
+	c++;
+      String *decl = NewString(c);
+      Chop(decl);
+      if (Len(decl) > 0 && ((char *)Char(decl))[Len(decl) - 1] == ';') {
+	Delitem(decl, DOH_END);
+	Chop(decl);
+      }
+      if (Len(decl) == 0) {
+	Delete(decl);
+	continue;
+      }
+
+      // Split into the declarator and the initializer at the first top level '='
+      const char *d = Char(decl);
+      const char *eq = 0;
+      int depth = 0;
+      for (const char *s = d; *s && !eq; s++) {
+	if (*s == '(' || *s == '[' || *s == '{')
+	  depth++;
+	else if (*s == ')' || *s == ']' || *s == '}')
+	  depth--;
+	else if (*s == '=' && depth == 0)
+	  eq = s;
+      }
+      String *declarator = eq ? NewStringWithSize(d, (int)(eq - d)) : NewString(d);
+      Chop(declarator);
+      String *init = 0;
+      if (eq) {
+	const char *i = eq + 1;
+	while (isspace((int)*i))
+	  i++;
+	init = NewString(i);
+      }
+
+      // The name is the last identifier, before any array dimensions
+      const char *start = Char(declarator);
+      const char *end = start + Len(declarator);
+      while (end > start && end[-1] == ']') {
+	while (end > start && *end != '[')
+	  end--;
+	while (end > start && isspace((int)end[-1]))
+	  end--;
+      }
+      const char *n = end;
+      while (n > start && (isalnum((int)n[-1]) || n[-1] == '_'))
+	n--;
+      String *name = NewStringWithSize(n, (int)(end - n));
+      const char *t = n;
+      while (t > start && isspace((int)t[-1]))
+	t--;
+
+      if (!Getattr(f->localh, name)) {
+	// Not added by Wrapper_add_local, such as kwnames, stays a local variable
+	Printv(locals, decl, f->end_statement, NIL);
+      } else {
+	bool zero = init && (Strcmp(init, "{0}") == 0 || Strcmp(init, "{ 0 }") == 0);
+	if ((t > start && t[-1] == '&') || Strncmp(declarator, "const ", 6) == 0 || Strncmp(declarator, "static ", 7) == 0 || (init && !zero && *Char(init) == '{')) {
+	  ok = false;
+	} else {
+	  Printv(members, "  ", declarator, f->end_statement, NIL);
+	  if (init && !zero)
+	    Printv(inits, name, " = ", init, f->end_statement, NIL);
+	  SetFlag(names, name);
+	}
+      }
+      Delete(name);
+      Delete(init);
+      Delete(declarator);
+      Delete(decl);
+    }
+    Delete(lines);
+
+    if (ok) {
+      if (objs > 0) {
+	Printf(members, "  PyObject *swig_obj[%d]%s", objs, f->end_statement);
+	SetFlag(names, "swig_obj");
+      }
+
+      // The caller converts the arguments into a new frame and submits the call, a worker continues after swig_async_run
+      String *body = NewString("");
+      Printv(body, inits, NIL);
+      Write(body, Char(f->code), (int)(split - Char(f->code)));
+      Printv(body, "return SWIG_Python_AsyncSubmit(swigc);\n", "swig_async_run:\n", split + strlen(marker), NIL);
+      String *frame_body = asyncFrameReplace(body, names);
+
+      String *code = NewString("");
+      Printf(code, "if (swigc->submitted) {\n");
+      Printf(code, "swigf = (%s *)swigc->frame;\n", frame);
+      Printf(code, "goto swig_async_run;\n");
+      Printf(code, "}\n");
+      if (CPlusPlus)
+	Printf(code, "swigf = new %s();\n", frame);
+      else
+	Printf(code, "swigf = (%s *)calloc(1, sizeof(%s));\n", frame, frame);
+      Printf(code, "if (!swigf) return PyErr_NoMemory();\n");
+      Printf(code, "SWIG_Python_AsyncSetFrame(swigc, swigf, %s_async_free, %s_async_run);\n", wname, wname);
+      if (objs > 0) {
+	Printf(code, "for (swig_i = 0; swig_i < nobjs && swig_i < %d; swig_i++) {\n", objs);
+	Printf(code, "swigf->swig_obj[swig_i] = swig_obj[swig_i];\n");
+	Printf(code, "}\n");
+	Printf(locals, "Py_ssize_t swig_i%s", f->end_statement);
+      }
+      Append(code, frame_body);
+
+      Printf(locals, "swig_async_call *swigc = SWIG_Python_AsyncCurrent()%s", f->end_statement);
+      Printf(locals, "%s *swigf = 0%s", frame, f->end_statement);
+
+      // The frame, and a forward declared wrapper called with the frame on a worker thread
+      String *decl = Copy(f->def);
+      Chop(decl);
+      if (Len(decl) > 0 && ((char *)Char(decl))[Len(decl) - 1] == '{') {
+	Delitem(decl, DOH_END);
+	Chop(decl);
+      }
+      Printf(f_wrappers, "typedef struct {\n%s} %s;\n\n", members, frame);
+      Printf(f_wrappers, "SWIGINTERN void %s_async_free(void *frame) {\n", wname);
+      if (CPlusPlus)
+	Printf(f_wrappers, "  delete (%s *)frame;\n", frame);
+      else
+	Printf(f_wrappers, "  free(frame);\n");
+      Printf(f_wrappers, "}\n\n");
+      Printf(f_wrappers, "%s;\n\n", decl);
+      Printf(f_wrappers, "SWIGINTERN PyObject *%s_async_run(swig_async_call *call) {\n", wname);
+      Printf(f_wrappers, "  return %s(%s);\n", wdefname, call_args);
+      Printf(f_wrappers, "}\n\n");
+
+      Clear(f->locals);
+      Append(f->locals, locals);
+      Clear(f->code);
+      Append(f->code, code);
+
+      Delete(decl);
+      Delete(code);
+      Delete(frame_body);
+      Delete(body);
+    }
+
+    Delete(names);
+    Delete(locals);
+    Delete(inits);
+    Delete(members);
+    Delete(frame);
+    return ok;
+  }
+
+  // Warns of an asynchronous function whose wrapper is not split by asyncFrameWrapper
+  void emitAsyncInline(Node *n, const char *reason) {
+    Swig_warning(WARN_PYTHON_ASYNC_INLINE, input_file, line_number, "Asynchronous function %s runs on the calling thread, %s.\n", Swig_name_decl(n), reason);
+  }
+
   int initialize_threads(String *f_init) {
     if (!threads) {
       return SWIG_OK;
@@ -399,6 +674,9 @@ public:
 	} else if (strcmp(argv[i], "-relativeimport") == 0) {
 	  relativeimport = 1;
 	  Swig_mark_arg(i);
+	} else if (strcmp(argv[i], "-deferinit") == 0) {
+	  deferinit = 1;
+	  Swig_mark_arg(i);
 	} else if (strcmp(argv[i], "-cppcast") == 0 ||
 		   strcmp(argv[i], "-fastinit") == 0 ||
 		   strcmp(argv[i], "-fastquery") == 0 ||
@@ -500,6 +778,9 @@ public:
 	  if (Getattr(options, "extranative")) {
 	    extranative = 1;
 	  }
+	  if (Getattr(options, "deferinit")) {
+	    deferinit = 1;
+	  }
 	  if (Getattr(options, "noextranative")) {
 	    Printf(stderr, "Deprecated module option: %s. This option is no longer supported.\n", "noextranative");
 	    SWIG_exit(EXIT_FAILURE);
@@ -519,6 +800,10 @@ public:
       }
     }
 
+    /* -builtin imports everything from the extension module with 'import *' so gains nothing from deferring */
+    if (builtin)
+      deferinit = 0;
+
     /* Set comparison with none for ConstructorToFunction */
     setSubclassInstanceCheck(NewString("$arg != Py_None"));
 
@@ -571,6 +856,10 @@ public:
 
     const_code = NewString("");
     methods = NewString("");
+    lazy_constants = NewString("");
+    lazy_constant_names = NewString("");
+    lazy_constant_count = 0;
+    lazy_shadow_names = NewList();
 
     Swig_banner(f_begin);
 
@@ -609,6 +898,10 @@ public:
       Printf(f_runtime, "#define SWIGPYTHON_BUILTIN\n");
     }
 
+    if (deferinit) {
+      Printf(f_runtime, "#define SWIG_PYTHON_DEFER_INIT\n");
+    }
+
     Printf(f_runtime, "\n");
 
     Printf(f_header, "#ifdef SWIG_TypeQuery\n");
@@ -820,6 +1113,10 @@ public:
       Swig_insert_file("director.swg", f_runtime);
     }
 
+    if (async_used) {
+      Swig_insert_file("pyasync.swg", f_runtime);
+    }
+
     /* Close language module */
     Append(methods, "\t { NULL, NULL, 0, NULL }\n");
     Append(methods, "};\n");
@@ -833,6 +1130,13 @@ public:
 
     Append(const_code, "{0, 0, 0, 0.0, 0, 0}};\n");
     Printf(f_wrappers, "%s\n", const_code);
+
+    if (deferinit) {
+      Printf(f_wrappers, "static const char *SwigLazyConstants[] = {\n%s\t NULL\n};\n\n", lazy_constant_names);
+      Printf(f_wrappers, "SWIGINTERN void\nSWIG_Python_LazyConstant(PyObject *d, size_t i) {\n");
+      Printf(f_wrappers, "  (void)d;\n");
+      Printf(f_wrappers, "  switch (i) {\n%s  default:\n    break;\n  }\n}\n\n", lazy_constants);
+    }
     initialize_threads(f_init);
 
     Printf(f_init, "#if PY_VERSION_HEX >= 0x03000000\n");
@@ -880,6 +1184,8 @@ public:
 
       Printv(f_shadow_py, "\n", f_shadow, "\n", NIL);
       Printv(f_shadow_py, f_shadow_stubs, "\n", NIL);
+      if (Len(lazy_shadow_names) > 0)
+	emitLazyShadowNames(f_shadow_py);
       Delete(f_shadow_py);
     }
 
@@ -902,6 +1208,9 @@ public:
     Wrapper_pretty_print(f_init, f_begin);
 
     Delete(default_import_code);
+    Delete(lazy_constants);
+    Delete(lazy_constant_names);
+    Delete(lazy_shadow_names);
     Delete(f_shadow_after_begin);
     Delete(f_shadow_imports);
     Delete(f_shadow_begin);
@@ -2043,8 +2352,13 @@ public:
 	else if (!Strchr(s, ':')) {
 	  Node *lookup = Swig_symbol_clookup(v, 0);
 	  if (lookup) {
-	    if (Cmp(Getattr(lookup, "nodeType"), "enumitem") == 0)
-	      result = Copy(Getattr(lookup, "sym:name"));
+	    if (Cmp(Getattr(lookup, "nodeType"), "enumitem") == 0) {
+	      // Deferred constants are not proxy module globals until first accessed
+	      if (GetFlag(lookup, "python:deferred"))
+		result = NewStringf("%s.%s", module, Getattr(lookup, "sym:name"));
+	      else
+		result = Copy(Getattr(lookup, "sym:name"));
+	    }
 	  }
 	}
       }
@@ -2253,6 +2567,23 @@ public:
   }
 
 
+  /* ------------------------------------------------------------
+   * have_proxy_code()
+   *
+   * Check if the proxy method for n, which is shared by all its
+   * overloads, runs Python code of its own
+   * ------------------------------------------------------------ */
+
+  bool have_proxy_code(Node *n) {
+    Node *overloaded = Getattr(n, "sym:overloaded");
+    for (Node *ni = overloaded ? overloaded : n; ni; ni = overloaded ? Getattr(ni, "sym:nextSibling") : 0) {
+      if (Getattr(ni, "feature:shadow") || have_pythonprepend(ni) || have_pythonappend(ni))
+	return true;
+    }
+    return false;
+  }
+
+
   /* ------------------------------------------------------------
    * returnTypeAnnotation()
    *
@@ -2414,8 +2745,11 @@ public:
     String *symname = Getattr(n, "sym:name");
     String *wname = Swig_name_wrapper(symname);
 
+    bool async_call = async_enable(n) && !builtin_ctor && Cmp(Getattr(n, "nodeType"), "constructor") != 0;
+    String *wdefname = async_call ? NewStringf("%s_sync", wname) : Copy(wname);
+
     const char *builtin_kwargs = builtin_ctor ? ", PyObject *SWIGUNUSEDPARM(kwargs)" : "";
-    Printv(f->def, linkage, builtin_ctor ? "int " : "PyObject *", wname, "(PyObject *self, PyObject *args", builtin_kwargs, ") {", NIL);
+    Printv(f->def, linkage, builtin_ctor ? "int " : "PyObject *", wdefname, "(PyObject *self, PyObject *args", builtin_kwargs, ") {", NIL);
 
     Wrapper_add_local(f, "argc", "Py_ssize_t argc");
     Printf(tmp, "PyObject *argv[%d] = {0}", maxargs + 1);
@@ -2473,6 +2807,8 @@ public:
     }
     Printv(f->code, "}\n", NIL);
     Wrapper_print(f, f_wrappers);
+    if (async_call)
+      emitAsyncWrapper(wname, wdefname, 0);
     Node *p = Getattr(n, "sym:previousSibling");
     if (!builtin_self)
       add_method(symname, wname, 0, p);
@@ -2486,6 +2822,7 @@ public:
     Delete(dispatch_code);
     Delete(tmp);
     Delete(wname);
+    Delete(wdefname);
   }
 
   /* ------------------------------------------------------------
@@ -2582,6 +2919,8 @@ public:
     bool add_self = builtin_self && (!builtin_ctor || director_class);
     bool builtin_getter = (builtin && GetFlag(n, "memberget"));
     bool builtin_setter = (builtin && GetFlag(n, "memberset") && !builtin_getter);
+    if (builtin_getter || builtin_setter)
+      allow_kwargs = 0;
     bool over_varargs = false;
     char const *self_param = builtin ? "self" : "SWIGUNUSEDPARM(self)";
     char const *wrap_return = builtin_ctor ? "int " : "PyObject *";
@@ -2604,6 +2943,7 @@ public:
     outarg = NewString("");
     kwargs = NewString("");
 
+    bool async_call = async_enable(n) && !constructor && !destructor && !GetFlag(n, "memberget") && !GetFlag(n, "memberset");
     int allow_thread = threads_enable(n);
 
     Wrapper_add_local(f, "resultobj", "PyObject *resultobj = 0");
@@ -2630,11 +2970,13 @@ public:
     if (overname) {
       Append(wname, overname);
     }
+    // An asynchronous function is registered as a wrapper scheduling a call of the usual wrapper, see emitAsyncWrapper
+    String *wdefname = async_call && !overname ? NewStringf("%s_sync", wname) : Copy(wname);
 
     const char *builtin_kwargs = builtin_ctor ? ", PyObject *SWIGUNUSEDPARM(kwargs)" : "";
     if (!allow_kwargs || overname) {
       if (!varargs) {
-	Printv(f->def, linkage, wrap_return, wname, "(PyObject *", self_param, ", PyObject *args", builtin_kwargs, ") {", NIL);
+	Printv(f->def, linkage, wrap_return, wdefname, "(PyObject *", self_param, ", PyObject *args", builtin_kwargs, ") {", NIL);
       } else {
 	Printv(f->def, linkage, wrap_return, wname, "__varargs__", "(PyObject *", self_param, ", PyObject *args, PyObject *varargs) {", NIL);
       }
@@ -2647,7 +2989,7 @@ public:
 	Swig_warning(WARN_LANG_VARARGS_KEYWORD, input_file, line_number, "Can't wrap varargs with keyword arguments enabled\n");
 	varargs = 0;
       }
-      Printv(f->def, linkage, wrap_return, wname, "(PyObject *", self_param, ", PyObject *args, PyObject *kwargs) {", NIL);
+      Printv(f->def, linkage, wrap_return, wdefname, "(PyObject *", self_param, ", PyObject *args, PyObject *kwargs) {", NIL);
     }
     if (!builtin || !in_class || tuple_arguments > 0) {
       if (!allow_kwargs) {
@@ -2675,7 +3017,8 @@ public:
 	over_varargs = true;
     }
 
-    int funpack = fastunpack && !varargs && !over_varargs && !allow_kwargs;
+    // Member variable setters always take the value unpacked so they can be called without an argument tuple
+    int funpack = (fastunpack || builtin_setter) && !varargs && !over_varargs && !allow_kwargs;
     int noargs = funpack && (tuple_required == 0 && tuple_arguments == 0);
     int onearg = funpack && (tuple_required == 1 && tuple_arguments == 1);
 
@@ -2832,7 +3175,7 @@ public:
 	  Printf(parse_args, "if ((nobjs < %d) || (nobjs > %d)) SWIG_fail;\n", num_required, num_arguments);
 	} else {
 	  int is_tp_call = Equal(Getattr(n, "feature:python:slot"), "tp_call");
-	  Printv(f->def, linkage, wrap_return, wname, "(PyObject *", self_param, ", PyObject *args", builtin_kwargs, ") {", NIL);
+	  Printv(f->def, linkage, wrap_return, wdefname, "(PyObject *", self_param, ", PyObject *args", builtin_kwargs, ") {", NIL);
 	  if (onearg && !builtin_ctor && !is_tp_call) {
 	    Printf(parse_args, "if (!args) SWIG_fail;\n");
 	    Append(parse_args, "swig_obj[0] = args;\n");
@@ -2950,6 +3293,10 @@ public:
     /* Emit the function call */
     if (director_method) {
       Append(f->code, "try {\n");
+    } else if (async_call) {
+      // Only the C/C++ call of an asynchronous function runs without the GIL, independently of -threads
+      Setattr(n, "wrap:preaction", "{\nSWIG_PYTHON_ASYNC_BEGIN_ALLOW;\n");
+      Setattr(n, "wrap:postaction", "\nSWIG_PYTHON_ASYNC_END_ALLOW;\n}");
     } else {
       if (allow_thread) {
 	String *preaction = NewString("");
@@ -2967,6 +3314,11 @@ public:
     Swig_director_emit_dynamic_cast(n, f);
     String *actioncode = emit_action(n);
 
+    // The wrapper of an asynchronous function is split before the C/C++ call, see asyncFrameWrapper
+    bool async_frame = async_call && !director_method && !varargs;
+    if (async_frame)
+      Insert(actioncode, 0, "SWIG_PYTHON_ASYNC_SPLIT\n");
+
     if (director_method) {
       Append(actioncode, "} catch (Swig::DirectorException&) {\n");
       Append(actioncode, "  SWIG_fail;\n");
@@ -3115,18 +3467,50 @@ public:
       Replaceall(f->code, "$self", "obj0");
     }
 
+    if (async_frame) {
+      const char *call_args = "call->self, call->args";
+      if (overname && funpack)
+	call_args = "call->self, 0, 0";
+      else if (allow_kwargs)
+	call_args = "call->self, call->args, call->kwargs";
+      if (!asyncFrameWrapper(f, wname, wdefname, call_args, overname && funpack && !noargs ? num_arguments : 0)) {
+	Replaceall(f->code, "SWIG_PYTHON_ASYNC_SPLIT\n", "");
+	emitAsyncInline(n, "a local variable can't be moved to a worker thread");
+      }
+    } else if (async_call) {
+      emitAsyncInline(n, director_method ? "it is a director method" : "it has variable arguments");
+    }
+
     /* Dump the function out */
     Wrapper_print(f, f_wrappers);
 
+    /* Builtin member variable access: native getset functions calling the wrapper directly */
+    String *builtin_getset_func = 0;
+    if (builtin_getter && !overname) {
+      builtin_getset_func = NewStringf("%s_getter", wname);
+      Printv(f_wrappers, "SWIGINTERN PyObject *", builtin_getset_func, "(PyObject *self, void *SWIGUNUSEDPARM(closure)) {\n", NIL);
+      Printv(f_wrappers, "  return ", wname, "(self, NULL);\n", "}\n\n", NIL);
+    } else if (builtin_setter && funpack && onearg && !overname) {
+      builtin_getset_func = NewStringf("%s_setter", wname);
+      Printv(f_wrappers, "SWIGINTERN int ", builtin_getset_func, "(PyObject *self, PyObject *value, void *SWIGUNUSEDPARM(closure)) {\n", NIL);
+      Printv(f_wrappers, "  PyObject *result;\n", NIL);
+      Printv(f_wrappers, "  if (!value) {\n", NIL);
+      Printv(f_wrappers, "    PyErr_Format(PyExc_TypeError, \"Illegal member variable deletion in type '%.300s'\", self->ob_type->tp_name);\n", NIL);
+      Printv(f_wrappers, "    return -1;\n", "  }\n", NIL);
+      Printv(f_wrappers, "  result = ", wname, "(self, value);\n", NIL);
+      Printv(f_wrappers, "  Py_XDECREF(result);\n", NIL);
+      Printv(f_wrappers, "  return result ? 0 : -1;\n", "}\n\n", NIL);
+    }
+
     /* If varargs.  Need to emit a varargs stub */
     if (varargs) {
       DelWrapper(f);
       f = NewWrapper();
       if (funpack) {
 	// Note: funpack is currently always false for varargs
-	Printv(f->def, linkage, wrap_return, wname, "(PyObject *", self_param, ", Py_ssize_t nobjs, PyObject **swig_obj) {", NIL);
+	Printv(f->def, linkage, wrap_return, wdefname, "(PyObject *", self_param, ", Py_ssize_t nobjs, PyObject **swig_obj) {", NIL);
       } else {
-	Printv(f->def, linkage, wrap_return, wname, "(PyObject *", self_param, ", PyObject *args", builtin_kwargs, ") {", NIL);
+	Printv(f->def, linkage, wrap_return, wdefname, "(PyObject *", self_param, ", PyObject *args", builtin_kwargs, ") {", NIL);
       }
       Wrapper_add_local(f, "resultobj", builtin_ctor ? "int resultobj" : "PyObject *resultobj");
       Wrapper_add_local(f, "varargs", "PyObject *varargs");
@@ -3155,6 +3539,9 @@ public:
       Wrapper_print(f, f_wrappers);
     }
 
+    if (async_call && !overname)
+      emitAsyncWrapper(wname, wdefname, allow_kwargs);
+
     /* Now register the function with the interpreter.   */
     if (!Getattr(n, "sym:overloaded")) {
       if (!builtin_self)
@@ -3202,6 +3589,15 @@ public:
 	Delete(h);
       }
       Setattr(h, "getter", wrapper_name);
+      if (builtin_getset_func)
+	Setattr(h, "getter:native", builtin_getset_func);
+      else
+	Delattr(h, "getter:native");
+      // Calling convention of the wrapper, the overload dispatcher accepts either
+      if (overname)
+	Delattr(h, "getter:funpack");
+      else
+	Setattr(h, "getter:funpack", funpack ? "1" : "0");
       Delattr(n, "memberget");
     }
     if (builtin_setter) {
@@ -3215,6 +3611,14 @@ public:
 	Delete(h);
       }
       Setattr(h, "setter", wrapper_name);
+      if (builtin_getset_func)
+	Setattr(h, "setter:native", builtin_getset_func);
+      else
+	Delattr(h, "setter:native");
+      if (overname)
+	Delattr(h, "setter:funpack");
+      else
+	Setattr(h, "setter:funpack", funpack ? "1" : "0");
       Delattr(n, "memberset");
     }
 
@@ -3263,6 +3667,8 @@ public:
     Delete(outarg);
     Delete(kwargs);
     Delete(wname);
+    Delete(wdefname);
+    Delete(builtin_getset_func);
     DelWrapper(f);
     Delete(wrapper_name);
     return SWIG_OK;
@@ -3431,6 +3837,38 @@ public:
     return result;
   }
 
+  /* ------------------------------------------------------------
+   * emitLazyShadowNames()
+   *
+   * With -deferinit the proxy module does not copy the constants from
+   * the extension module at import. A module level __getattr__ (PEP 562)
+   * copies each one on first access instead. Python versions prior to
+   * 3.7 do not support this and copy them all at import as usual.
+   * ------------------------------------------------------------ */
+
+  void emitLazyShadowNames(File *f_dest) {
+    Printv(f_dest, "_swig_lazy_names = frozenset((\n", NIL);
+    for (Iterator it = First(lazy_shadow_names); it.item; it = Next(it)) {
+      Printv(f_dest, tab4, "\"", it.item, "\",\n", NIL);
+    }
+    Printv(f_dest, "))\n\n", NIL);
+    Printv(f_dest,
+	   "def __getattr__(name):\n",
+	   tab4, "if name in _swig_lazy_names:\n",
+	   tab8, "value = getattr(", module, ", name)\n",
+	   tab8, "globals()[name] = value\n",
+	   tab8, "return value\n",
+	   tab4, "if name == \"__all__\":\n",
+	   tab8, "return [n for n in __dir__() if not n.startswith(\"_\")]\n",
+	   tab4, "raise AttributeError(\"module %r has no attribute %r\" % (__name__, name))\n\n",
+	   "def __dir__():\n",
+	   tab4, "return sorted(set(globals()) | _swig_lazy_names)\n\n",
+	   "if _swig_python_version_info < (3, 7, 0):\n",
+	   tab4, "for _swig_name in _swig_lazy_names:\n",
+	   tab8, "globals()[_swig_name] = getattr(", module, ", _swig_name)\n",
+	   tab4, "del _swig_name\n\n", NIL);
+  }
+
   virtual int constantWrapper(Node *n) {
     String *name = Getattr(n, "name");
     String *iname = Getattr(n, "sym:name");
@@ -3500,6 +3938,10 @@ public:
 	String *cname = NewStringf("%s_swigconstant", iname);
 	add_method(cname, cname, 0);
 	Delete(cname);
+      } else if (deferinit) {
+	// Created on first access by the module __getattr__, see pyinit.swg
+	Printf(lazy_constants, "  case %d: {\n    %s\n  }\n    break;\n", lazy_constant_count++, tm);
+	Printf(lazy_constant_names, "\t \"%s\",\n", iname);
       } else {
         Printf(f_init, "%s\n", tm);
       }
@@ -3527,6 +3969,10 @@ public:
 	if (needs_swigconstant(n)) {
 	  Printv(f_s, "\n",NIL);
 	  Printv(f_s, module, ".", iname, "_swigconstant(",module,")\n", NIL);
+	} else if (deferinit) {
+	  Append(lazy_shadow_names, iname);
+	  SetFlag(n, "python:deferred");
+	  return SWIG_OK;
 	}
 	Printv(f_s, iname, " = ", module, ".", iname, "\n", NIL);
 	if (have_docstring(n))
@@ -3722,6 +4168,28 @@ public:
       Printf(f_directors_h, "private:\n");
       Printf(f_directors_h, "    mutable swig::SwigVar_PyObject vtable[%d];\n", director_method_index);
       Printf(f_directors_h, "#endif\n\n");
+
+      /* Method names, interned when the module is initialized */
+      String *dirclassname = NewStringf("SwigDirector_%s", Getattr(n, "sym:name"));
+      Printf(f_directors_h, "public:\n");
+      Printf(f_directors_h, "    static PyObject *swig_method_names[%d];\n", director_method_index);
+      Printf(f_directors_h, "#if !defined(SWIG_PYTHON_DIRECTOR_NO_OVERRIDE_CACHE)\n");
+      Printf(f_directors_h, "    static PyObject *swig_method_originals[%d];\n", director_method_index);
+      Printf(f_directors_h, "    static void swig_register_class(PyObject *klass) {\n");
+      Printf(f_directors_h, "      Swig::OverrideCache<%d>::register_class(klass, swig_method_names, swig_method_originals);\n", director_method_index);
+      Printf(f_directors_h, "    }\n");
+      Printf(f_directors_h, "private:\n");
+      Printf(f_directors_h, "    Swig::OverrideCache<%d> swig_override;\n", director_method_index);
+      Printf(f_directors_h, "#endif\n");
+      Printf(f_directors, "PyObject *%s::swig_method_names[%d];\n", dirclassname, director_method_index);
+      Printf(f_directors, "#if !defined(SWIG_PYTHON_DIRECTOR_NO_OVERRIDE_CACHE)\n");
+      Printf(f_directors, "PyObject *%s::swig_method_originals[%d];\n", dirclassname, director_method_index);
+      Printf(f_directors, "#endif\n\n");
+      Setattr(n, "python:director:register", dirclassname);
+      int i = 0;
+      for (Iterator it = First(director_method_names); it.item; it = Next(it), ++i)
+	Printf(f_init, "%s::swig_method_names[%d] = SWIG_Python_str_InternFromChar(\"%s\");\n", dirclassname, i, it.item);
+      Delete(dirclassname);
     }
 
     Printf(f_directors_h, "};\n\n");
@@ -3886,8 +4354,15 @@ public:
       Hash *mgetset = member_iter.item;
       String *getter = Getattr(mgetset, "getter");
       String *setter = Getattr(mgetset, "setter");
-      const char *getter_closure = getter ? funpack ? "SwigPyBuiltin_FunpackGetterClosure" : "SwigPyBuiltin_GetterClosure" : "0";
-      const char *setter_closure = setter ? funpack ? "SwigPyBuiltin_FunpackSetterClosure" : "SwigPyBuiltin_SetterClosure" : "0";
+      String *getter_native = Getattr(mgetset, "getter:native");
+      String *setter_native = Getattr(mgetset, "setter:native");
+      // The fallback closures must match how each wrapper was generated, setters are always unpacked
+      String *getter_funpack = Getattr(mgetset, "getter:funpack");
+      String *setter_funpack = Getattr(mgetset, "setter:funpack");
+      int getter_unpacked = getter_funpack ? Equal(getter_funpack, "1") : funpack;
+      int setter_unpacked = setter_funpack ? Equal(setter_funpack, "1") : funpack;
+      const char *getter_closure = getter_native ? Char(getter_native) : getter ? getter_unpacked ? "SwigPyBuiltin_FunpackGetterClosure" : "SwigPyBuiltin_GetterClosure" : "0";
+      const char *setter_closure = setter_native ? Char(setter_native) : setter ? setter_unpacked ? "SwigPyBuiltin_FunpackSetterClosure" : "SwigPyBuiltin_SetterClosure" : "0";
       String *gspair = NewStringf("%s_%s_getset", symname, memname);
       Printf(f, "static SwigPyGetSet %s = { %s, %s };\n", gspair, getter ? getter : "0", setter ? setter : "0");
       String *entry =
@@ -4209,6 +4684,8 @@ public:
     Printv(f_init, "      return;\n", NIL);
     Printv(f_init, "#endif\n", NIL);
     Printv(f_init, "    }\n", NIL);
+    if (GetFlag(n, "feature:python:identitycache"))
+      Printf(f_init, "    SwigPyClientData_EnableIdentityCache(&%s_clientdata);\n", templ);
     Printv(f_init, "    Py_INCREF(builtin_pytype);\n", NIL);
     Printf(f_init, "    PyModule_AddObject(m, \"%s\", (PyObject *)builtin_pytype);\n", symname);
     Printf(f_init, "    SwigPyBuiltin_AddPublicSymbol(public_interface, \"%s\");\n", symname);
@@ -4408,8 +4885,18 @@ public:
 	  Printv(f_wrappers, "  if (!PyArg_UnpackTuple(args, \"swigregister\", 1, 1, &obj)) return NULL;\n", NIL);
 	}
 
-	Printv(f_wrappers,
-	       "  SWIG_TypeNewClientData(SWIGTYPE", SwigType_manglestr(ct), ", SWIG_NewClientData(obj));\n", "  return SWIG_Py_Void();\n", "}\n\n", NIL);
+	Printv(f_wrappers, "  SWIG_TypeNewClientData(SWIGTYPE", SwigType_manglestr(ct), ", SWIG_NewClientData(obj));\n", NIL);
+	if (GetFlag(n, "feature:python:identitycache"))
+	  Printv(f_wrappers, "  SwigPyClientData_EnableIdentityCache((SwigPyClientData *) SWIGTYPE", SwigType_manglestr(ct), "->clientdata);\n", NIL);
+	if (Getattr(n, "python:dealloc"))
+	  Printv(f_wrappers, "  SwigPyClientData_SetDealloc((SwigPyClientData *) SWIGTYPE", SwigType_manglestr(ct), "->clientdata, (PyCFunction)",
+		 Getattr(n, "python:dealloc:wrapper"), ", ", Getattr(n, "python:dealloc"), ");\n", NIL);
+	if (Getattr(n, "python:director:register")) {
+	  Printv(f_wrappers, "#if !defined(SWIG_PYTHON_DIRECTOR_NO_OVERRIDE_CACHE)\n", NIL);
+	  Printv(f_wrappers, "  ", Getattr(n, "python:director:register"), "::swig_register_class(obj);\n", NIL);
+	  Printv(f_wrappers, "#endif\n", NIL);
+	}
+	Printv(f_wrappers, "  return SWIG_Py_Void();\n", "}\n\n", NIL);
 	String *cname = NewStringf("%s_swigregister", class_name);
 	add_method(cname, cname, 0);
 	Delete(cname);
@@ -4795,6 +5282,49 @@ public:
     return SWIG_OK;
   }
 
+  /* ------------------------------------------------------------
+   * emitDirectDealloc()
+   *
+   * Emit a plain C function that deletes an instance without going
+   * through the destructor wrapper, for use by SwigPyObject_dealloc
+   * when an owned object is garbage collected. Only done when the
+   * wrapper's action is a simple delete with no exception handling,
+   * contracts or thread handling around it.
+   * ------------------------------------------------------------ */
+
+  void emitDirectDealloc(Node *n) {
+    Node *cls = Swig_methodclass(n);
+    String *wname = Getattr(n, "wrap:name");
+    String *action = Getattr(n, "wrap:action");
+    String *except = GetFlagAttr(n, "feature:except");
+    SwigType *smart = Swig_cparse_smartptr(cls);
+
+    bool direct = wname && action && !smart;
+    if (except && Len(except) && Strcmp(except, "1") != 0)
+      direct = false;
+    if (Getattr(n, "feature:action") || Getattr(n, "catchlist") || Getattr(n, "wrap:preaction") || Getattr(n, "wrap:postaction"))
+      direct = false;
+    if (Swig_contract_mode_get() && (Len(Getattr(n, "contract:preassert")) || Len(Getattr(n, "contract:postassert"))))
+      direct = false;
+
+    if (direct) {
+      SwigType *pt = Copy(getClassType());
+      SwigType_add_pointer(pt);
+      String *arg = Swig_cparm_name(0, 0);
+      String *dname = NewStringf("%s_dealloc", wname);
+      Printf(f_wrappers, "SWIGINTERN void %s(void *ptr) {\n", dname);
+      Printf(f_wrappers, "  %s = (%s) ptr;\n", SwigType_lstr(pt, arg), SwigType_lstr(pt, 0));
+      Printf(f_wrappers, "  %s\n", action);
+      Printf(f_wrappers, "}\n\n");
+      Setattr(cls, "python:dealloc", dname);
+      Setattr(cls, "python:dealloc:wrapper", wname);
+      Delete(dname);
+      Delete(arg);
+      Delete(pt);
+    }
+    Delete(smart);
+  }
+
   /* ------------------------------------------------------------
    * destructorHandler()
    * ------------------------------------------------------------ */
@@ -4818,6 +5348,9 @@ public:
     Language::destructorHandler(n);
     shadow = oldshadow;
 
+    if (shadow && !builtin)
+      emitDirectDealloc(n);
+
     if (shadow) {
       if (Getattr(n, "feature:shadow")) {
 	String *pycode = indent_pythoncode(Getattr(n, "feature:shadow"), tab4, Getfile(n), Getline(n), "%feature(\"shadow\")");
@@ -5084,6 +5617,8 @@ public:
  * --------------------------------------------------------------- */
 int PYTHON::classDirectorMethods(Node *n) {
   director_method_index = 0;
+  Delete(director_method_names);
+  director_method_names = NewList();
   return Language::classDirectorMethods(n);
 }
 
@@ -5358,9 +5893,40 @@ int PYTHON::classDirectorMethod(Node *n, Node *parent, String *super) {
 
     /* add the method name as a PyString */
     String *pyname = Getattr(n, "sym:name");
+    int method_index = director_method_index++;
+    Append(director_method_names, pyname);
 
     int allow_thread = threads_enable(n);
 
+    /* call the C++ method directly if the Python class does not override it,
+       unless the proxy method has %pythonprepend, %pythonappend or shadow code to run */
+    if (!pure_virtual && !have_proxy_code(n)) {
+      SwigType *ct = Copy(c_classname);
+      SwigType_add_pointer(ct);
+      String *super_call = Swig_method_call(super, l);
+      Append(w->code, "#if !defined(SWIG_PYTHON_DIRECTOR_NO_OVERRIDE_CACHE)\n");
+      Append(w->code, "{\n");
+      Append(w->code, "bool swig_overridden;\n");
+      if (allow_thread)
+	thread_begin_block(n, w->code);
+      Printf(w->code, "swig_overridden = swig_override.overridden(swig_get_self(), %d, swig_method_names[%d], swig_method_originals[%d], SWIGTYPE%s);\n",
+	     method_index, method_index, method_index, SwigType_manglestr(ct));
+      if (allow_thread)
+	thread_end_block(n, w->code);
+      Append(w->code, "if (!swig_overridden) {\n");
+      if (is_void) {
+	Printf(w->code, "%s;\n", super_call);
+	Append(w->code, "return;\n");
+      } else {
+	Printf(w->code, "return %s;\n", super_call);
+      }
+      Append(w->code, "}\n");
+      Append(w->code, "}\n");
+      Append(w->code, "#endif\n");
+      Delete(super_call);
+      Delete(ct);
+    }
+
     if (allow_thread) {
       thread_begin_block(n, w->code);
       Append(w->code, "{\n");
@@ -5379,7 +5945,7 @@ int PYTHON::classDirectorMethod(Node *n, Node *parent, String *super) {
     Printf(w->code, "  Swig::DirectorException::raise(\"'self' uninitialized, maybe you forgot to call %s.__init__.\");\n", classname);
     Append(w->code, "}\n");
     Append(w->code, "#if defined(SWIG_PYTHON_DIRECTOR_VTABLE)\n");
-    Printf(w->code, "const size_t swig_method_index = %d;\n", director_method_index++);
+    Printf(w->code, "const size_t swig_method_index = %d;\n", method_index);
     Printf(w->code, "const char *const swig_method_name = \"%s\";\n", pyname);
 
     Append(w->code, "PyObject *method = swig_get_method(swig_method_index, swig_method_name);\n");
@@ -5398,12 +5964,10 @@ int PYTHON::classDirectorMethod(Node *n, Node *parent, String *super) {
       if (use_parse) {
 	Printf(w->code, "swig::SwigVar_PyObject %s = PyObject_CallMethod(swig_get_self(), (char *)\"%s\", (char *)\"(%s)\" %s);\n", Swig_cresult_name(), pyname, parse_args, arglist);
       } else {
-	Printf(w->code, "swig::SwigVar_PyObject swig_method_name = SWIG_Python_str_FromChar(\"%s\");\n", pyname);
-	Printf(w->code, "swig::SwigVar_PyObject %s = PyObject_CallMethodObjArgs(swig_get_self(), (PyObject *) swig_method_name %s, NULL);\n", Swig_cresult_name(), arglist);
+	Printf(w->code, "swig::SwigVar_PyObject %s = PyObject_CallMethodObjArgs(swig_get_self(), swig_method_names[%d] %s, NULL);\n", Swig_cresult_name(), method_index, arglist);
       }
     } else {
-      Printf(w->code, "swig::SwigVar_PyObject swig_method_name = SWIG_Python_str_FromChar(\"%s\");\n", pyname);
-      Printf(w->code, "swig::SwigVar_PyObject %s = PyObject_CallMethodObjArgs(swig_get_self(), (PyObject *) swig_method_name, NULL);\n", Swig_cresult_name());
+      Printf(w->code, "swig::SwigVar_PyObject %s = PyObject_CallMethodObjArgs(swig_get_self(), swig_method_names[%d], NULL);\n", Swig_cresult_name(), method_index);
     }
     Append(w->code, "#endif\n");
 
@@ -168,6 +168,7 @@ private:
 
   bool useGlobalModule;
   bool multipleInheritance;
+  bool nogvlUsed;		/* ruby/thread.h has been included */
 
   // Wrap modes
   enum WrapperMode {
@@ -811,6 +812,7 @@ public:
     f_initbeforefunc(0),
     useGlobalModule(false),
     multipleInheritance(false),
+    nogvlUsed(false),
     last_mode(AUTODOC_NONE),
     last_autodoc(NewString("")) {
       current = NO_CPP;
@@ -1654,6 +1656,141 @@ public:
     return 1;
   }
 
+  /* ---------------------------------------------------------------------
+   * nogvlWrapper()
+   *
+   * Implements %feature("nogvl"). The call to the wrapped function is moved
+   * into a helper function run by rb_thread_call_without_gvl(), so argument
+   * and result conversion stay in the wrapper with the GVL held. The helper
+   * reaches the wrapper's argument and result locals through a context
+   * struct. C++ exceptions are caught in the helper and rethrown in the
+   * wrapper for the throws typemaps and %exception to handle as usual.
+   * Replaces wrap:action with the call and returns the helper code, or
+   * returns 0 if the GVL cannot be released around this call.
+   * --------------------------------------------------------------------- */
+
+  String *nogvlWrapper(Node *n, ParmList *l, SwigType *t, String *wname, Wrapper *f, int director_method, int varargs) {
+    const char *reason = 0;
+
+    /* Constructors are silently skipped so the feature can be enabled for a whole class */
+    if (current == CONSTRUCTOR_ALLOCATE || current == CONSTRUCTOR_INITIALIZE)
+      return 0;
+    if (director_method || Wrapper_check_local(f, "darg"))
+      reason = "director methods";
+    else if (varargs)
+      reason = "variable length arguments";
+    else if (Getattr(n, "feature:action"))
+      reason = "%feature(\"action\")";
+    if (reason) {
+      Swig_warning(WARN_RUBY_NOGVL_UNSUPPORTED, input_file, line_number,
+		   "Ignoring nogvl feature for '%s', the GVL cannot be released for %s.\n", Getattr(n, "sym:name"), reason);
+      return 0;
+    }
+
+    if (!nogvlUsed) {
+      Printf(f_header, "\n#include <ruby/thread.h>\n");
+      if (CPlusPlus) {
+	Printf(f_header, "#if __cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1900)\n");
+	Printf(f_header, "#include <exception>\n");
+	Printf(f_header, "#define SWIG_RUBY_NOGVL_EXCEPTION_PTR\n");
+	Printf(f_header, "#endif\n");
+      }
+      nogvlUsed = true;
+    }
+
+    String *ctxname = NewStringf("%s_nogvl", wname);
+    String *helpername = NewStringf("%s_nogvl_call", wname);
+    String *fields = NewString("");
+    String *bind = NewString("");
+    String *setup = NewString("");
+    String *writeback = NewString("");
+
+    /* The argument locals as declared by Swig_cargs() followed by the result local */
+    int compactdefargs = ParmList_is_compactdefargs(l);
+    List *names = NewList();
+    List *types = NewList();
+    for (Parm *p = l; p; p = nextSibling(p)) {
+      SwigType *pt = Getattr(p, "type");
+      if (SwigType_type(pt) == T_VOID)
+	continue;
+      SwigType *altty = (compactdefargs && Getattr(p, "value")) ? 0 : SwigType_alttype(pt, 0);
+      Append(names, Getattr(p, "lname"));
+      Append(types, SwigType_ltype(altty ? altty : pt));
+      Delete(altty);
+    }
+    if (SwigType_type(t) != T_VOID) {
+      SwigType *vt = cplus_value_type(t);
+      Append(names, Swig_cresult_name());
+      Append(types, SwigType_ltype(vt ? vt : t));
+      Delete(vt);
+    }
+
+    for (int i = 0; i < Len(names); i++) {
+      String *name = Getitem(names, i);
+      SwigType *lt = Getitem(types, i);
+      SwigType *ptrtype = Copy(lt);
+      SwigType_add_pointer(ptrtype);
+      String *field = SwigType_str(ptrtype, name);
+      Printf(fields, "  %s;\n", field);
+      if (CPlusPlus) {
+	SwigType *reftype = Copy(lt);
+	SwigType_add_reference(reftype);
+	String *ref = SwigType_str(reftype, name);
+	Printf(bind, "  %s = *swig_ctx->%s;\n", ref, name);
+	Delete(ref);
+	Delete(reftype);
+      } else {
+	String *local = SwigType_str(lt, name);
+	Printf(bind, "  %s = *swig_ctx->%s;\n", local, name);
+	Printf(writeback, "  *swig_ctx->%s = %s;\n", name, name);
+	Delete(local);
+      }
+      Printf(setup, "  swig_ctx.%s = &%s;\n", name, name);
+      Delete(field);
+      Delete(ptrtype);
+    }
+    if (Len(fields) == 0 && !CPlusPlus)
+      Printf(fields, "  char swig_unused;\n");
+
+    String *helper = NewString("");
+    Printf(helper, "struct %s {\n%s", ctxname, fields);
+    if (CPlusPlus)
+      Printf(helper, "#ifdef SWIG_RUBY_NOGVL_EXCEPTION_PTR\n  std::exception_ptr swig_exception;\n#endif\n");
+    Printf(helper, "};\n\n");
+    Printf(helper, "SWIGINTERN void *\n%s(void *swig_data) {\n", helpername);
+    Printf(helper, "  struct %s *swig_ctx SWIGUNUSED = (struct %s *)swig_data;\n%s", ctxname, ctxname, bind);
+    if (CPlusPlus) {
+      Printf(helper, "#ifdef SWIG_RUBY_NOGVL_EXCEPTION_PTR\n  try {\n#endif\n");
+      Printf(helper, "%s\n", Getattr(n, "wrap:action"));
+      Printf(helper, "#ifdef SWIG_RUBY_NOGVL_EXCEPTION_PTR\n  } catch (...) {\n");
+      Printf(helper, "    swig_ctx->swig_exception = std::current_exception();\n  }\n#endif\n");
+    } else {
+      Printf(helper, "%s\n%s", Getattr(n, "wrap:action"), writeback);
+    }
+    Printf(helper, "  return 0;\n}\n\n");
+
+    String *ubf = Getattr(n, "feature:nogvl:ubf");
+    String *ubfdata = Getattr(n, "feature:nogvl:ubfdata");
+    String *action = NewString("{\n");
+    Printf(action, "  struct %s swig_ctx;\n%s", ctxname, setup);
+    Printf(action, "  rb_thread_call_without_gvl(%s, &swig_ctx, %s, (void *)(%s));\n", helpername, ubf ? ubf : "0", ubfdata ? ubfdata : "0");
+    if (CPlusPlus)
+      Printf(action, "#ifdef SWIG_RUBY_NOGVL_EXCEPTION_PTR\n  if (swig_ctx.swig_exception) std::rethrow_exception(swig_ctx.swig_exception);\n#endif\n");
+    Printf(action, "}\n");
+    Setattr(n, "wrap:action", action);
+
+    Delete(action);
+    Delete(names);
+    Delete(types);
+    Delete(writeback);
+    Delete(setup);
+    Delete(bind);
+    Delete(fields);
+    Delete(helpername);
+    Delete(ctxname);
+    return helper;
+  }
+
   /* ---------------------------------------------------------------------
    * functionWrapper()
    *
@@ -1699,6 +1836,7 @@ public:
     String *cleanup = NewString("");
     String *outarg = NewString("");
     String *kwargs = NewString("");
+    String *nogvl_helper = 0;
     Wrapper *f = NewWrapper();
 
     /* Rename predicate methods */
@@ -1840,7 +1978,7 @@ public:
 	  }
 	  Printf(action, "\nDATA_PTR(self) = %s;", result_name);
 	  if (GetFlag(pn, "feature:trackobjects")) {
-	    Printf(action, "\nSWIG_RubyAddTracking(%s, self);", result_name);
+	    Printf(action, "\nSWIG_RubyTrackingsAdd(SWIG_Ruby_ClassTrackings(&SwigClass%s), %s, self);", klass->name, result_name);
 	  }
 	  Delete(result_name);
 	  Delete(smart);
@@ -1855,7 +1993,16 @@ public:
       Setattr(n, "wrap:name", wname);
 
       Swig_director_emit_dynamic_cast(n, f);
+      String *orig_action = 0;
+      if (GetFlag(n, "feature:nogvl")) {
+	orig_action = Copy(Getattr(n, "wrap:action"));
+	nogvl_helper = nogvlWrapper(n, l, t, wname, f, director_method, varargs);
+      }
       String *actioncode = emit_action(n);
+      if (orig_action) {
+	Setattr(n, "wrap:action", orig_action);
+	Delete(orig_action);
+      }
 
       if (director_method) {
 	Printf(actioncode, "} catch (Swig::DirectorException& e) {\n");
@@ -2034,6 +2181,10 @@ public:
     Replaceall(f->code, "$symname", symname);
 
     /* Emit the function */
+    if (nogvl_helper) {
+      Printv(f_wrappers, nogvl_helper, NIL);
+      Delete(nogvl_helper);
+    }
     Wrapper_print(f, f_wrappers);
 
     /* Now register the function with the interpreter */
@@ -2752,7 +2903,7 @@ public:
     /* Check to see if object tracking is activated for the class
        that owns this destructor. */
     if (GetFlag(pn, "feature:trackobjects")) {
-      Printf(freebody, "SWIG_RubyRemoveTracking(%s);\n", pname0);
+      Printf(freebody, "SWIG_RubyRemoveClassTracking(SwigClass%s.trackings, %s);\n", klass->name, pname0);
       Printv(freebody, tab4, NIL);
     }
 